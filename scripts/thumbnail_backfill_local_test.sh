@@ -0,0 +1,111 @@
+#!/bin/bash
+# End-to-end check of thumbnail_backfill against MinIO and DynamoDB Local.
+#
+# Usage: scripts/thumbnail_backfill_local_test.sh <sample.jpg> [path/to/thumbnail_backfill]
+#
+# Needs docker and the AWS CLI. Seeds a bucket and table with IMAGE_COUNT
+# copies of the sample plus one image without a table item, then checks:
+#   1. the first run processes every image and reports the orphan
+#   2. thumbnails and thumbnail_key are written
+#   3. a rerun skips everything from the checkpoint
+#   4. a rerun with a new --max-dimension refuses the old checkpoint
+
+set -euo pipefail
+
+SAMPLE="${1:?Usage: $0 <sample.jpg> [thumbnail_backfill]}"
+BACKFILL="${2:-build/bin/tools/thumbnail_backfill}"
+
+BUCKET_NAME="npu-backfill-test"
+TABLE_NAME="NPUCreationsBackfillTest"
+IMAGE_COUNT=200
+S3_ENDPOINT="http://localhost:9000"
+DYNAMODB_ENDPOINT="http://localhost:8000"
+WORK_DIR="$(mktemp -d)"
+CHECKPOINT="$WORK_DIR/backfill.checkpoint"
+
+export AWS_ACCESS_KEY_ID="minioadmin"
+export AWS_SECRET_ACCESS_KEY="minioadmin"
+export AWS_REGION="us-east-1"
+
+# Check if required tools are installed
+for tool in docker aws; do
+    if ! command -v "$tool" &> /dev/null; then
+        echo "$tool could not be found. Please install it."
+        exit 1
+    fi
+done
+
+cleanup() {
+    docker rm -f npu-minio npu-dynamodb-local > /dev/null 2>&1 || true
+    rm -rf "$WORK_DIR"
+}
+trap cleanup EXIT
+
+fail() {
+    echo "FAILED: $1"
+    exit 1
+}
+
+# 1. Start MinIO and DynamoDB Local
+echo "Starting MinIO and DynamoDB Local..."
+docker run -d --rm --name npu-minio -p 9000:9000 minio/minio server /data > /dev/null
+docker run -d --rm --name npu-dynamodb-local -p 8000:8000 amazon/dynamodb-local > /dev/null
+until curl -sf "$S3_ENDPOINT/minio/health/live" > /dev/null; do sleep 1; done
+until aws dynamodb list-tables --endpoint-url "$DYNAMODB_ENDPOINT" > /dev/null 2>&1; do sleep 1; done
+
+# 2. Create bucket and table
+aws s3api create-bucket --bucket "$BUCKET_NAME" --endpoint-url "$S3_ENDPOINT" > /dev/null
+aws dynamodb create-table \
+    --table-name "$TABLE_NAME" \
+    --attribute-definitions AttributeName=creation_id,AttributeType=S AttributeName=user_id,AttributeType=S \
+    --key-schema AttributeName=creation_id,KeyType=HASH AttributeName=user_id,KeyType=RANGE \
+    --billing-mode PAY_PER_REQUEST \
+    --endpoint-url "$DYNAMODB_ENDPOINT" > /dev/null
+
+# 3. Seed images and items, plus one orphan image
+echo "Seeding $IMAGE_COUNT images..."
+for i in $(seq 1 "$IMAGE_COUNT"); do
+    cp "$SAMPLE" "$WORK_DIR/creation-$i.jpg"
+    aws dynamodb put-item \
+        --table-name "$TABLE_NAME" \
+        --item "{\"creation_id\": {\"S\": \"creation-$i\"}, \"user_id\": {\"S\": \"user-$((i % 7))\"}, \"image_key\": {\"S\": \"images/creation-$i.jpg\"}}" \
+        --endpoint-url "$DYNAMODB_ENDPOINT"
+done
+cp "$SAMPLE" "$WORK_DIR/orphan.jpg"
+aws s3 cp "$WORK_DIR" "s3://$BUCKET_NAME/images/" --recursive --exclude "*" --include "*.jpg" \
+    --endpoint-url "$S3_ENDPOINT" > /dev/null
+
+run_backfill() {
+    "$BACKFILL" --bucket "$BUCKET_NAME" --table "$TABLE_NAME" --region "$AWS_REGION" \
+        --checkpoint "$CHECKPOINT" \
+        --s3-endpoint "$S3_ENDPOINT" --dynamodb-endpoint "$DYNAMODB_ENDPOINT" "$@"
+}
+
+# 4. First run: everything processed, the orphan reported
+echo "First run..."
+run_backfill --thumbnail-prefix thumbnails/320/ --max-dimension 320 | tee "$WORK_DIR/first.txt"
+grep -q "^Processed:  $IMAGE_COUNT$" "$WORK_DIR/first.txt" || fail "not every image was processed"
+grep -q "^Orphaned:   1 " "$WORK_DIR/first.txt" || fail "orphan image was not reported"
+
+# 5. Thumbnails and thumbnail_key written
+aws s3api head-object --bucket "$BUCKET_NAME" --key thumbnails/320/creation-1.jpg \
+    --endpoint-url "$S3_ENDPOINT" > /dev/null || fail "thumbnail missing"
+THUMBNAIL_KEY=$(aws dynamodb get-item \
+    --table-name "$TABLE_NAME" \
+    --key '{"creation_id": {"S": "creation-1"}, "user_id": {"S": "user-1"}}' \
+    --query 'Item.thumbnail_key.S' --output text \
+    --endpoint-url "$DYNAMODB_ENDPOINT")
+[ "$THUMBNAIL_KEY" = "thumbnails/320/creation-1.jpg" ] || fail "thumbnail_key is '$THUMBNAIL_KEY'"
+
+# 6. Rerun with the same settings: nothing left to do
+echo "Second run..."
+run_backfill --thumbnail-prefix thumbnails/320/ --max-dimension 320 | tee "$WORK_DIR/second.txt"
+grep -q "^Skipped:    $IMAGE_COUNT " "$WORK_DIR/second.txt" || fail "checkpoint was not honoured"
+
+# 7. New thumbnail size with the old checkpoint: refused
+echo "Third run (new size, old checkpoint)..."
+if run_backfill --thumbnail-prefix thumbnails/160/ --max-dimension 160; then
+    fail "checkpoint from a different size was reused"
+fi
+
+echo "Thumbnail backfill local test passed."
@@ -1,4 +1,5 @@
 #include "creation.hpp"
+#include "creation_schema.hpp"
 #include <aws/core/utils/UUID.h>
 #include <aws/core/utils/DateTime.h>
 
@@ -11,8 +12,5 @@ void Creation::generate_id()
 
 bool Creation::validate() const
 {
-    return !element_name.empty() &&
-           !title.empty() &&
-           !image_data.empty() &&
-           !user_id.empty();
+    return creation_schema::validate(*this);
 }
\ No newline at end of file
@@ -2,6 +2,15 @@
 #include <string>
 #include <vector>
 
+/**
+ * @brief Aggregated votes of a creation, stored as the `scores` map
+ */
+struct Scores
+{
+    long long total_score = 0;
+    long long vote_count = 0;
+};
+
 struct Creation
 {
     std::string creation_id;
@@ -14,7 +23,17 @@ struct Creation
     std::string thumbnail_key;
     std::vector<std::string> tags;
     std::string creation_date;
+    Scores scores;
 
     void generate_id();
     bool validate() const; // Declaration
-};
\ No newline at end of file
+};
+
+/**
+ * @brief Primary key of a creation in the NPUCreations table
+ */
+struct CreationKey
+{
+    std::string creation_id;
+    std::string user_id;
+};
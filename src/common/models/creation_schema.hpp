@@ -0,0 +1,593 @@
+#pragma once
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/dynamodb/model/AttributeValue.h>
+#include <charconv>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "creation.hpp"
+
+/**
+ * @brief Compile-time field schema of Creation
+ *
+ * Every encoder and decoder below is a fold over FIELDS, so each field gets
+ * its own unrolled, type-specialized code path and its key string is built
+ * once per process. Supported member types are std::string, lists of
+ * strings, long long (DynamoDB N) and nested records with their own field
+ * list (DynamoDB M, JSON object). Adding a field of one of these types is
+ * one line in FIELDS plus the member; a new nested record type also needs
+ * its field list and a Schema specialization, like Scores.
+ */
+namespace creation_schema
+{
+    /**
+     * @brief Where a field is read from or written to
+     */
+    enum Usage : unsigned
+    {
+        REQUEST = 1u << 0,  // Parsed from the create request body
+        STORED = 1u << 1,   // Persisted in the NPUCreations table
+        RESPONSE = 1u << 2, // Returned to the client
+        DETAIL = 1u << 3,   // Returned by the read endpoints
+        FEED = 1u << 4,     // Copied into the feed views, see FeedEntry
+        CARD = 1u << 5,     // Returned on feed and leaderboard cards
+    };
+
+    template <typename Record, typename T>
+    struct Field
+    {
+        const char *name;
+        T Record::*member;
+        unsigned usage;
+        bool required;
+        std::size_t max_length; // 0 means unbounded; applies to each element of a list
+    };
+
+    template <typename Record, typename T>
+    constexpr Field<Record, T> field(const char *name, T Record::*member, unsigned usage,
+                                     bool required, std::size_t max_length)
+    {
+        return Field<Record, T>{name, member, usage, required, max_length};
+    }
+
+    inline constexpr auto SCORE_FIELDS = std::make_tuple(
+        field("total_score", &Scores::total_score, STORED | DETAIL | FEED | CARD, false, 0),
+        field("vote_count", &Scores::vote_count, STORED | DETAIL | FEED | CARD, false, 0));
+
+    inline constexpr auto FIELDS = std::make_tuple(
+        field("creation_id", &Creation::creation_id, STORED | RESPONSE | DETAIL | FEED | CARD, false, 64),
+        field("user_id", &Creation::user_id, REQUEST | STORED | DETAIL | FEED | CARD, true, 128),
+        field("element_name", &Creation::element_name, REQUEST | STORED | RESPONSE | DETAIL | FEED | CARD, true, 128),
+        field("title", &Creation::title, REQUEST | STORED | RESPONSE | DETAIL | FEED | CARD, true, 256),
+        field("description", &Creation::description, REQUEST | STORED | DETAIL, false, 2048),
+        field("image_data", &Creation::image_data, REQUEST, true, 0),
+        field("image_key", &Creation::image_key, STORED, false, 1024),
+        field("thumbnail_key", &Creation::thumbnail_key, STORED | FEED, false, 1024),
+        field("tags", &Creation::tags, REQUEST | STORED | RESPONSE | DETAIL, false, 64),
+        field("creation_date", &Creation::creation_date, STORED | RESPONSE | DETAIL | FEED | CARD, false, 64),
+        field("scores", &Creation::scores, STORED | DETAIL | FEED | CARD, false, 0));
+
+    inline constexpr std::size_t FIELD_COUNT = std::tuple_size_v<decltype(FIELDS)>;
+
+    /**
+     * @brief Parse a DynamoDB number attribute as a score or count, without throwing
+     *
+     * Values beyond the range of long long saturate, so one oversized number
+     * cannot fail a whole batch. Shared by every decoder that reads an N.
+     * @return false, with `value` set to 0, if `text` is not an integer
+     */
+    inline bool parse_number(std::string_view text, long long &value) noexcept
+    {
+        const char *last = text.data() + text.size();
+        const auto [end, error] = std::from_chars(text.data(), last, value);
+        if (error == std::errc::result_out_of_range && end == last)
+        {
+            value = text.front() == '-' ? std::numeric_limits<long long>::min()
+                                        : std::numeric_limits<long long>::max();
+            return true;
+        }
+        if (error != std::errc() || end != last)
+        {
+            value = 0;
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Field list of a record type
+     */
+    template <typename Record>
+    struct Schema;
+
+    template <>
+    struct Schema<Creation>
+    {
+        static constexpr const auto &fields = FIELDS;
+    };
+
+    template <>
+    struct Schema<Scores>
+    {
+        static constexpr const auto &fields = SCORE_FIELDS;
+    };
+
+    namespace detail
+    {
+        using Aws::DynamoDB::Model::AttributeValue;
+
+        template <typename Record>
+        inline constexpr std::size_t field_count =
+            std::tuple_size_v<std::decay_t<decltype(Schema<Record>::fields)>>;
+
+        template <typename Record, typename F, std::size_t... I>
+        void for_each_field(F &&f, std::index_sequence<I...>)
+        {
+            (f(std::get<I>(Schema<Record>::fields), std::integral_constant<std::size_t, I>{}), ...);
+        }
+
+        template <typename Record, typename F>
+        void for_each_field(F &&f)
+        {
+            for_each_field<Record>(std::forward<F>(f), std::make_index_sequence<field_count<Record>>{});
+        }
+
+        /**
+         * @brief Key string of field I of Record, built on first use
+         */
+        template <typename Record, std::size_t I>
+        const Aws::String &key()
+        {
+            static const Aws::String name(std::get<I>(Schema<Record>::fields).name);
+            return name;
+        }
+
+        // Per-type primitives. Records are handled by the templates further
+        // down, which recurse into these through their field list.
+
+        inline bool is_empty(const std::string &value) { return value.empty(); }
+        inline bool is_empty(const std::vector<std::string> &value) { return value.empty(); }
+        inline bool is_empty(long long) { return false; }
+
+        // Strings and numbers are always written, matching the stored item
+        // layout; empty lists are left out.
+        inline bool omit(const std::string &) { return false; }
+        inline bool omit(const std::vector<std::string> &value) { return value.empty(); }
+        inline bool omit(long long) { return false; }
+
+        inline bool exceeds(const std::string &value, std::size_t max_length)
+        {
+            return value.size() > max_length;
+        }
+
+        inline bool exceeds(const std::vector<std::string> &value, std::size_t max_length)
+        {
+            for (const auto &element : value)
+            {
+                if (element.size() > max_length)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        inline bool exceeds(long long, std::size_t) { return false; }
+
+        inline void encode(const std::string &value, unsigned, AttributeValue &out)
+        {
+            out.SetS(value);
+        }
+
+        inline void encode(const std::vector<std::string> &value, unsigned, AttributeValue &out)
+        {
+            Aws::Vector<std::shared_ptr<AttributeValue>> list;
+            list.reserve(value.size());
+            for (const auto &element : value)
+            {
+                auto element_av = Aws::MakeShared<AttributeValue>("CreationSchema");
+                element_av->SetS(element);
+                list.push_back(std::move(element_av));
+            }
+            out.SetL(std::move(list));
+        }
+
+        inline void encode(long long value, unsigned, AttributeValue &out)
+        {
+            out.SetN(std::to_string(value));
+        }
+
+        // Decoders return false for a value they cannot read, which is left
+        // as its zero value; the rest of the record is still decoded.
+
+        inline bool decode(const AttributeValue &value, unsigned, std::string &out)
+        {
+            out = value.GetS();
+            return true;
+        }
+
+        inline bool decode(const AttributeValue &value, unsigned, std::vector<std::string> &out)
+        {
+            const auto list = value.GetL();
+            out.clear();
+            out.reserve(list.size());
+            for (const auto &element : list)
+            {
+                out.emplace_back(element->GetS());
+            }
+            return true;
+        }
+
+        inline bool decode(const AttributeValue &value, unsigned, long long &out)
+        {
+            if (value.GetN().empty())
+            {
+                out = 0;
+                return true;
+            }
+            return parse_number(value.GetN(), out);
+        }
+
+        inline void write(Aws::Utils::Json::JsonValue &json, const Aws::String &key,
+                          const std::string &value, unsigned)
+        {
+            json.WithString(key, value);
+        }
+
+        inline void write(Aws::Utils::Json::JsonValue &json, const Aws::String &key,
+                          const std::vector<std::string> &value, unsigned)
+        {
+            Aws::Utils::Array<Aws::Utils::Json::JsonValue> array(value.size());
+            for (size_t i = 0; i < value.size(); ++i)
+            {
+                array[i].AsString(value[i]);
+            }
+            json.WithArray(key, std::move(array));
+        }
+
+        inline void write(Aws::Utils::Json::JsonValue &json, const Aws::String &key,
+                          long long value, unsigned)
+        {
+            json.WithInt64(key, value);
+        }
+
+        inline void read(const Aws::Utils::Json::JsonView &json, const Aws::String &key,
+                         std::string &out, unsigned)
+        {
+            out = json.GetString(key);
+        }
+
+        inline void read(const Aws::Utils::Json::JsonView &json, const Aws::String &key,
+                         std::vector<std::string> &out, unsigned)
+        {
+            const auto array = json.GetArray(key);
+            out.clear();
+            out.reserve(array.GetLength());
+            for (size_t i = 0; i < array.GetLength(); ++i)
+            {
+                out.emplace_back(array[i].AsString());
+            }
+        }
+
+        inline void read(const Aws::Utils::Json::JsonView &json, const Aws::String &key,
+                         long long &out, unsigned)
+        {
+            out = json.GetInt64(key);
+        }
+
+        // Nested records. Declared up front so the record templates can
+        // recurse into each other.
+
+        template <typename Record>
+        bool exceeds(const Record &value, std::size_t max_length);
+        template <typename Record>
+        void encode(const Record &value, unsigned usage, AttributeValue &out);
+        template <typename Record>
+        bool decode(const AttributeValue &value, unsigned usage, Record &out);
+        template <typename Record>
+        void write(Aws::Utils::Json::JsonValue &json, const Aws::String &key,
+                   const Record &value, unsigned usage);
+        template <typename Record>
+        void read(const Aws::Utils::Json::JsonView &json, const Aws::String &key,
+                  Record &out, unsigned usage);
+
+        template <typename Record>
+        bool is_empty(const Record &) { return false; }
+
+        template <typename Record>
+        bool omit(const Record &) { return false; }
+
+        template <typename Record>
+        bool exceeds(const Record &value, std::size_t)
+        {
+            bool exceeded = false;
+            for_each_field<Record>([&](const auto &field, auto)
+            {
+                exceeded = exceeded ||
+                           (field.max_length != 0 && exceeds(value.*field.member, field.max_length));
+            });
+            return exceeded;
+        }
+
+        template <typename Record>
+        Aws::Map<Aws::String, AttributeValue> encode_record(const Record &record, unsigned usage)
+        {
+            Aws::Map<Aws::String, AttributeValue> item;
+            for_each_field<Record>([&](const auto &field, auto index)
+            {
+                const auto &value = record.*field.member;
+                if (!(field.usage & usage) || omit(value))
+                {
+                    return;
+                }
+                encode(value, usage, item[key<Record, decltype(index)::value>()]);
+            });
+            return item;
+        }
+
+        // Items are plain maps, nested M values map to shared pointers
+        inline const AttributeValue *find(const Aws::Map<Aws::String, AttributeValue> &item,
+                                          const Aws::String &name)
+        {
+            const auto it = item.find(name);
+            return it == item.end() ? nullptr : &it->second;
+        }
+
+        inline const AttributeValue *find(
+            const Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>> &item,
+            const Aws::String &name)
+        {
+            const auto it = item.find(name);
+            return it == item.end() ? nullptr : it->second.get();
+        }
+
+        template <typename T>
+        inline constexpr bool is_record = std::is_class_v<T> &&
+                                          !std::is_same_v<T, std::string> &&
+                                          !std::is_same_v<T, std::vector<std::string>>;
+
+        template <typename Record, typename Map>
+        bool decode_record(const Map &item, Record &record, unsigned usage)
+        {
+            bool valid = true;
+            for_each_field<Record>([&](const auto &field, auto index)
+            {
+                if (!(field.usage & usage))
+                {
+                    return;
+                }
+                if (const AttributeValue *value = find(item, key<Record, decltype(index)::value>()))
+                {
+                    valid = decode(*value, usage, record.*field.member) && valid;
+                }
+            });
+            return valid;
+        }
+
+        // Feed items keep nested records flat, e.g. total_score next to title
+
+        template <typename Record>
+        void encode_flat(const Record &record, unsigned usage, Aws::Map<Aws::String, AttributeValue> &item)
+        {
+            for_each_field<Record>([&](const auto &field, auto index)
+            {
+                const auto &value = record.*field.member;
+                if (!(field.usage & usage))
+                {
+                    return;
+                }
+                if constexpr (is_record<std::decay_t<decltype(value)>>)
+                {
+                    encode_flat(value, usage, item);
+                }
+                else if (!omit(value))
+                {
+                    encode(value, usage, item[key<Record, decltype(index)::value>()]);
+                }
+            });
+        }
+
+        template <typename Record, typename Map>
+        bool decode_flat(const Map &item, Record &record, unsigned usage)
+        {
+            bool valid = true;
+            for_each_field<Record>([&](const auto &field, auto index)
+            {
+                auto &value = record.*field.member;
+                if (!(field.usage & usage))
+                {
+                    return;
+                }
+                if constexpr (is_record<std::decay_t<decltype(value)>>)
+                {
+                    valid = decode_flat(item, value, usage) && valid;
+                }
+                else if (const AttributeValue *attribute = find(item, key<Record, decltype(index)::value>()))
+                {
+                    valid = decode(*attribute, usage, value) && valid;
+                }
+            });
+            return valid;
+        }
+
+        template <typename Record>
+        void encode(const Record &value, unsigned usage, AttributeValue &out)
+        {
+            Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>> map;
+            for (auto &entry : encode_record(value, usage))
+            {
+                map.emplace(entry.first,
+                            Aws::MakeShared<AttributeValue>("CreationSchema", std::move(entry.second)));
+            }
+            out.SetM(std::move(map));
+        }
+
+        template <typename Record>
+        bool decode(const AttributeValue &value, unsigned usage, Record &out)
+        {
+            return decode_record(value.GetM(), out, usage);
+        }
+
+        template <typename Record>
+        void write_record(Aws::Utils::Json::JsonValue &json, const Record &record, unsigned usage)
+        {
+            for_each_field<Record>([&](const auto &field, auto index)
+            {
+                const auto &value = record.*field.member;
+                if (!(field.usage & usage) || omit(value))
+                {
+                    return;
+                }
+                write(json, key<Record, decltype(index)::value>(), value, usage);
+            });
+        }
+
+        template <typename Record>
+        void read_record(const Aws::Utils::Json::JsonView &json, Record &record, unsigned usage)
+        {
+            for_each_field<Record>([&](const auto &field, auto index)
+            {
+                if (!(field.usage & usage))
+                {
+                    return;
+                }
+                const Aws::String &name = key<Record, decltype(index)::value>();
+                if (!json.KeyExists(name))
+                {
+                    if (field.required)
+                    {
+                        throw std::runtime_error("Missing required fields");
+                    }
+                    return;
+                }
+                read(json, name, record.*field.member, usage);
+            });
+        }
+
+        template <typename Record>
+        void write(Aws::Utils::Json::JsonValue &json, const Aws::String &key,
+                   const Record &value, unsigned usage)
+        {
+            Aws::Utils::Json::JsonValue object;
+            write_record(object, value, usage);
+            json.WithObject(key, std::move(object));
+        }
+
+        template <typename Record>
+        void read(const Aws::Utils::Json::JsonView &json, const Aws::String &key,
+                  Record &out, unsigned usage)
+        {
+            read_record(json.GetObject(key), out, usage);
+        }
+    }
+
+    /**
+     * @brief Names of the top-level fields with the given usage, e.g. for a ProjectionExpression
+     */
+    inline std::vector<const char *> field_names(unsigned usage)
+    {
+        std::vector<const char *> names;
+        names.reserve(FIELD_COUNT);
+        std::apply([&](const auto &...fields)
+                   { ((fields.usage & usage ? names.push_back(fields.name) : void()), ...); },
+                   FIELDS);
+        return names;
+    }
+
+    /**
+     * @brief Call f(field, index) for every top-level field, unrolled at compile time
+     */
+    template <typename F>
+    void for_each_field(F &&f)
+    {
+        detail::for_each_field<Creation>(std::forward<F>(f));
+    }
+
+    /**
+     * @brief Check required fields are present and no field exceeds its max length
+     */
+    inline bool validate(const Creation &creation)
+    {
+        bool valid = true;
+        for_each_field([&](const auto &field, auto)
+        {
+            const auto &value = creation.*field.member;
+            if ((field.required && detail::is_empty(value)) ||
+                (field.max_length != 0 && detail::exceeds(value, field.max_length)))
+            {
+                valid = false;
+            }
+        });
+        return valid;
+    }
+
+    /**
+     * @brief Encode the STORED fields as a DynamoDB item; empty lists are omitted
+     */
+    inline Aws::Map<Aws::String, Aws::DynamoDB::Model::AttributeValue>
+    to_attribute_map(const Creation &creation)
+    {
+        return detail::encode_record(creation, STORED);
+    }
+
+    /**
+     * @brief Decode the fields with the given usage from a DynamoDB item; missing attributes are left untouched
+     * @param usage STORED for a whole item, FEED for the card fields of a creation
+     * @return false if a value could not be read; it is left as 0 and the rest is decoded
+     */
+    inline bool from_attribute_map(
+        const Aws::Map<Aws::String, Aws::DynamoDB::Model::AttributeValue> &item,
+        Creation &creation,
+        unsigned usage = STORED)
+    {
+        return detail::decode_record(item, creation, usage);
+    }
+
+    /**
+     * @brief Encode the FEED fields as a feed table item, with the scores flattened
+     */
+    inline Aws::Map<Aws::String, Aws::DynamoDB::Model::AttributeValue>
+    to_feed_item(const Creation &creation)
+    {
+        Aws::Map<Aws::String, Aws::DynamoDB::Model::AttributeValue> item;
+        detail::encode_flat(creation, FEED, item);
+        return item;
+    }
+
+    /**
+     * @brief Decode a feed table item written by to_feed_item()
+     * @param item Top-level item, or the map of a nested M value
+     * @return false if a value could not be read; it is left as 0 and the rest is decoded
+     */
+    template <typename Map>
+    bool from_feed_item(const Map &item, Creation &creation)
+    {
+        return detail::decode_flat(item, creation, FEED);
+    }
+
+    /**
+     * @brief Write the fields with the given usage into a JSON object; empty lists are omitted
+     */
+    inline void to_json(const Creation &creation, unsigned usage,
+                        Aws::Utils::Json::JsonValue &json)
+    {
+        detail::write_record(json, creation, usage);
+    }
+
+    /**
+     * @brief Read the fields with the given usage from a JSON object
+     * @throws std::runtime_error if a required field is missing
+     */
+    inline void from_json(const Aws::Utils::Json::JsonView &json, unsigned usage,
+                          Creation &creation)
+    {
+        detail::read_record(json, creation, usage);
+    }
+}
@@ -0,0 +1,10 @@
+#include "feed_entry.hpp"
+#include "creation_schema.hpp"
+
+Aws::Utils::Json::JsonValue FeedEntry::to_json(const std::string &base_url) const
+{
+    Aws::Utils::Json::JsonValue json;
+    creation_schema::to_json(*this, creation_schema::CARD, json);
+    json.WithString("thumbnail_url", base_url + thumbnail_key);
+    return json;
+}
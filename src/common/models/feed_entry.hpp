@@ -0,0 +1,21 @@
+#pragma once
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <string>
+#include "creation.hpp"
+
+/**
+ * @brief Denormalized card data kept in the precomputed feed views
+ *
+ * Holds only what a feed or leaderboard card renders, so a page can be
+ * served straight from the feed table without touching the main table.
+ * Only the creation_schema::FEED fields are set; the feed item layout and
+ * the card JSON are derived from the schema.
+ */
+struct FeedEntry : Creation
+{
+    /**
+     * @brief Render the card as returned by the feed endpoints
+     * @param base_url Public bucket URL the thumbnail key is appended to
+     */
+    Aws::Utils::Json::JsonValue to_json(const std::string &base_url) const;
+};
@@ -0,0 +1,60 @@
+#include "request_limits.hpp"
+#include "creation_schema.hpp"
+#include <cstdlib>
+#include <string>
+#include <type_traits>
+
+namespace
+{
+    // Event fields around the body: request context, headers, query string
+    constexpr std::size_t ENVELOPE_BYTES = 64 * 1024;
+    // "data:image/jpeg;base64," and similar
+    constexpr std::size_t DATA_URI_BYTES = 64;
+    // A control character written as \u0000 in the body, its backslash
+    // escaped again when API Gateway embeds the body in the event
+    constexpr std::size_t MAX_ESCAPED_BYTE = 7;
+
+    template <typename T>
+    void override_from_env(const char *name, T &value)
+    {
+        if (const char *env = std::getenv(name))
+        {
+            value = static_cast<T>(std::stoull(env));
+        }
+    }
+}
+
+std::size_t RequestLimits::payload_limit() const
+{
+    if (max_payload_bytes != 0)
+    {
+        return max_payload_bytes;
+    }
+
+    std::size_t fields = 0;
+    creation_schema::for_each_field([&](const auto &field, auto)
+    {
+        using Value = std::decay_t<decltype(std::declval<Creation>().*field.member)>;
+        if (field.usage & creation_schema::REQUEST)
+        {
+            const std::size_t count = std::is_same_v<Value, std::vector<std::string>> ? max_tags : 1;
+            fields += count * field.max_length * MAX_ESCAPED_BYTE;
+        }
+    });
+
+    // Base64 grows the image by 4/3; clients that write '/' as "\/" add
+    // about 3% more, which the 1/16 allowance covers twice over
+    const std::size_t base64 = (max_image_bytes + 2) / 3 * 4;
+    return base64 + base64 / 16 + DATA_URI_BYTES + fields + ENVELOPE_BYTES;
+}
+
+RequestLimits RequestLimits::from_environment()
+{
+    RequestLimits limits;
+    override_from_env("MAX_PAYLOAD_BYTES", limits.max_payload_bytes);
+    override_from_env("MAX_IMAGE_BYTES", limits.max_image_bytes);
+    override_from_env("MAX_TAGS", limits.max_tags);
+    override_from_env("MAX_IMAGE_DIMENSION", limits.max_image_dimension);
+    override_from_env("MAX_IMAGE_PIXELS", limits.max_image_pixels);
+    return limits;
+}
@@ -0,0 +1,29 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Upper bounds applied to create requests before any expensive work
+ */
+struct RequestLimits
+{
+    std::size_t max_payload_bytes = 0;             // 0 derives it from the other limits, see payload_limit()
+    std::size_t max_image_bytes = 4 * 1024 * 1024;   // Decoded image size
+    std::size_t max_tags = 20;
+    std::uint32_t max_image_dimension = 8192;
+    std::uint64_t max_image_pixels = 40'000'000;
+
+    /**
+     * @brief Largest event a request within the image, field and tag limits can produce
+     *
+     * max_payload_bytes if set, otherwise the base64 size of max_image_bytes
+     * plus the escaped size of every request field and the API Gateway envelope.
+     */
+    std::size_t payload_limit() const;
+
+    /**
+     * @brief Load limits, overriding defaults with MAX_PAYLOAD_BYTES,
+     *        MAX_IMAGE_BYTES, MAX_TAGS, MAX_IMAGE_DIMENSION and MAX_IMAGE_PIXELS
+     */
+    static RequestLimits from_environment();
+};
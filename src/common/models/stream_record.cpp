@@ -0,0 +1,106 @@
+#include "stream_record.hpp"
+#include "creation_schema.hpp"
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/dynamodb/model/AttributeValue.h>
+#include <stdexcept>
+
+namespace
+{
+    using Aws::DynamoDB::Model::AttributeValue;
+
+    // Stream images use the low-level DynamoDB JSON encoding ({"S": "..."}),
+    // which AttributeValue already knows how to read.
+    FeedEntry decode_image(Aws::Utils::Json::JsonView image_json)
+    {
+        Aws::Map<Aws::String, AttributeValue> image;
+        for (const auto &attribute : image_json.GetAllObjects())
+        {
+            image.emplace(attribute.first, AttributeValue(attribute.second));
+        }
+        return feed_entry_from_creation(image);
+    }
+
+    CreationStreamRecord decode_record(Aws::Utils::Json::JsonView record)
+    {
+        const Aws::String event_name = record.GetString("eventName");
+
+        CreationStreamRecord decoded;
+        if (event_name == "INSERT")
+        {
+            decoded.event_type = CreationStreamRecord::EventType::Insert;
+        }
+        else if (event_name == "MODIFY")
+        {
+            decoded.event_type = CreationStreamRecord::EventType::Modify;
+        }
+        else if (event_name == "REMOVE")
+        {
+            decoded.event_type = CreationStreamRecord::EventType::Remove;
+        }
+        else
+        {
+            throw std::runtime_error("Unknown stream event name: " + event_name);
+        }
+
+        const Aws::Utils::Json::JsonView change = record.GetObject("dynamodb");
+        if (change.KeyExists("NewImage"))
+        {
+            decoded.new_image = decode_image(change.GetObject("NewImage"));
+            decoded.has_new_image = true;
+        }
+        if (change.KeyExists("OldImage"))
+        {
+            decoded.old_image = decode_image(change.GetObject("OldImage"));
+            decoded.has_old_image = true;
+        }
+        return decoded;
+    }
+}
+
+FeedEntry feed_entry_from_creation(const Aws::Map<Aws::String, AttributeValue> &item)
+{
+    FeedEntry entry;
+    if (!creation_schema::from_attribute_map(item, entry, creation_schema::FEED))
+    {
+        throw std::invalid_argument("Malformed card attribute in creation " + entry.creation_id);
+    }
+    return entry;
+}
+
+CreationStreamBatch parse_stream_event(const Aws::String &payload)
+{
+    using namespace Aws::Utils::Json;
+
+    JsonValue json(payload);
+    if (!json.WasParseSuccessful())
+    {
+        throw std::runtime_error("Failed to parse stream event JSON");
+    }
+
+    JsonView view = json.View();
+    if (!view.KeyExists("Records"))
+    {
+        throw std::runtime_error("Missing 'Records' in stream event");
+    }
+
+    const auto records = view.GetArray("Records");
+    CreationStreamBatch batch;
+    batch.records.reserve(records.GetLength());
+
+    // A record that cannot be decoded is skipped rather than failing the
+    // batch: Lambda would retry the same batch forever and block the shard.
+    for (size_t i = 0; i < records.GetLength(); ++i)
+    {
+        try
+        {
+            batch.records.push_back(decode_record(records[i]));
+        }
+        catch (const std::exception &e)
+        {
+            batch.errors.push_back("Record " + std::string(records[i].GetString("eventID")) +
+                                   ": " + e.what());
+        }
+    }
+
+    return batch;
+}
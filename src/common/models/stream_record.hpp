@@ -0,0 +1,51 @@
+#pragma once
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/dynamodb/model/AttributeValue.h>
+#include <string>
+#include <vector>
+#include "feed_entry.hpp"
+
+/**
+ * @brief A single NPUCreations change decoded from a DynamoDB Streams record
+ */
+struct CreationStreamRecord
+{
+    enum class EventType
+    {
+        Insert,
+        Modify,
+        Remove
+    };
+
+    EventType event_type = EventType::Insert;
+    bool has_new_image = false;
+    bool has_old_image = false;
+    FeedEntry new_image;
+    FeedEntry old_image;
+};
+
+/**
+ * @brief Records of one stream event that could be decoded, and why the rest could not
+ */
+struct CreationStreamBatch
+{
+    std::vector<CreationStreamRecord> records; // In stream order
+    std::vector<std::string> errors;           // One per skipped record
+};
+
+/**
+ * @brief Decode a DynamoDB Streams Lambda event
+ * @param payload Raw event JSON, as delivered by the Lambda runtime or recorded from it
+ * @throws std::runtime_error if the payload is not a valid stream event;
+ *         malformed records are reported in CreationStreamBatch::errors instead
+ */
+CreationStreamBatch parse_stream_event(const Aws::String &payload);
+
+/**
+ * @brief Extract the card fields of an NPUCreations item
+ * @param item Table item, stream image or index query result
+ * @throws std::invalid_argument if a card field cannot be read, e.g. a non-numeric score
+ */
+FeedEntry feed_entry_from_creation(
+    const Aws::Map<Aws::String, Aws::DynamoDB::Model::AttributeValue> &item);
@@ -1,11 +1,70 @@
 #include "dynamodb_service.hpp"
+#include "../models/creation_schema.hpp"
+#include <aws/dynamodb/model/BatchGetItemRequest.h>
 #include <aws/dynamodb/model/PutItemRequest.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <algorithm>
+#include <future>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace
+{
+    constexpr std::size_t MAX_BATCH_GET = 100;
+    constexpr int MAX_BATCH_GET_ATTEMPTS = 6;
+    constexpr int BASE_BACKOFF_MS = 25;
+
+    // "<length of creation_id>:<creation_id><user_id>", unambiguous for any characters
+    std::string cache_key(const std::string &creation_id, const std::string &user_id)
+    {
+        return std::to_string(creation_id.size()) + ':' + creation_id + user_id;
+    }
+
+    std::pair<std::string, std::string> split_cache_key(const std::string &key)
+    {
+        const std::size_t colon = key.find(':');
+        const std::size_t length = std::stoul(key.substr(0, colon));
+        return {key.substr(colon + 1, length), key.substr(colon + 1 + length)};
+    }
+
+    // Full jitter: uniform in [0, base * 2^attempt)
+    void backoff(int attempt)
+    {
+        thread_local std::mt19937 generator(std::random_device{}());
+        std::uniform_int_distribution<int> delay(0, (BASE_BACKOFF_MS << attempt) - 1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(delay(generator)));
+    }
+
+    // Projection of the stored fields; names are aliased since several
+    // (e.g. "title") may collide with DynamoDB reserved words.
+    const Aws::DynamoDB::Model::KeysAndAttributes &projection()
+    {
+        static const Aws::DynamoDB::Model::KeysAndAttributes attributes = []
+        {
+            Aws::DynamoDB::Model::KeysAndAttributes result;
+            Aws::String expression;
+            const auto names = creation_schema::field_names(creation_schema::STORED);
+            for (std::size_t i = 0; i < names.size(); ++i)
+            {
+                const Aws::String alias = "#f" + std::to_string(i);
+                expression += (i == 0 ? "" : ", ") + alias;
+                result.AddExpressionAttributeNames(alias, names[i]);
+            }
+            result.SetProjectionExpression(expression);
+            return result;
+        }();
+        return attributes;
+    }
+}
 
 DynamoDBService::DynamoDBService(
     const Aws::DynamoDB::DynamoDBClient &client,
-    std::string_view table_name) noexcept
-    : client_(client), table_name_(table_name) {}
+    std::string_view table_name,
+    std::chrono::milliseconds cache_ttl,
+    std::size_t cache_capacity) noexcept
+    : client_(client), table_name_(table_name), cache_(cache_ttl, cache_capacity) {}
 
 bool DynamoDBService::save_creation(const Creation &creation) const
 {
@@ -22,45 +81,8 @@ bool DynamoDBService::save_creation(const Creation &creation) const
         Aws::DynamoDB::Model::PutItemRequest request;
         request.SetTableName(table_name_);
 
-        // Create attribute map
-        Aws::Map<Aws::String, Aws::DynamoDB::Model::AttributeValue> item;
-
-        // Add required fields
-        item["creation_id"].SetS(creation.creation_id);
-        item["user_id"].SetS(creation.user_id);
-        item["element_name"].SetS(creation.element_name);
-        item["title"].SetS(creation.title);
-        item["description"].SetS(creation.description);
-        item["image_key"].SetS(creation.image_key);
-        item["thumbnail_key"].SetS(creation.thumbnail_key);
-        item["creation_date"].SetS(creation.creation_date);
-
-        // Add tags if present
-        if (!creation.tags.empty())
-        {
-            Aws::Vector<std::shared_ptr<Aws::DynamoDB::Model::AttributeValue>> tag_list;
-            tag_list.reserve(creation.tags.size()); // Optimize vector growth
-
-            for (const auto &tag : creation.tags)
-            {
-                auto tag_av = Aws::MakeShared<Aws::DynamoDB::Model::AttributeValue>("TagAttribute");
-                tag_av->SetS(tag);
-                tag_list.push_back(tag_av);
-            }
-            item["tags"].SetL(std::move(tag_list)); // Use move semantics
-        }
-
-        // Initialize scores map
-        Aws::Map<Aws::String, const std::shared_ptr<Aws::DynamoDB::Model::AttributeValue>> scores;
-        const auto total_score = Aws::MakeShared<Aws::DynamoDB::Model::AttributeValue>("TotalScore");
-        const auto vote_count = Aws::MakeShared<Aws::DynamoDB::Model::AttributeValue>("VoteCount");
-        total_score->SetN("0");
-        vote_count->SetN("0");
-        scores.emplace("total_score", total_score);
-        scores.emplace("vote_count", vote_count);
-        item["scores"].SetM(scores);
-
-        request.SetItem(item);
+        // Encode all stored fields, including the scores map, from the schema
+        request.SetItem(creation_schema::to_attribute_map(creation));
 
         // Execute the request
         const auto outcome = client_.PutItem(request);
@@ -82,4 +104,120 @@ bool DynamoDBService::save_creation(const Creation &creation) const
                             "Exception while saving creation: " << e.what());
         return false;
     }
-}
\ No newline at end of file
+}
+
+std::vector<std::shared_ptr<const Creation>> DynamoDBService::get_creations(
+    std::span<const CreationKey> keys) const
+{
+    std::vector<std::string> cache_keys;
+    cache_keys.reserve(keys.size());
+    for (const auto &key : keys)
+    {
+        cache_keys.push_back(cache_key(key.creation_id, key.user_id));
+    }
+
+    return cache_.get(cache_keys, [this](const std::vector<std::string> &misses)
+                      { return batch_get(misses); });
+}
+
+DynamoDBService::CreationMap DynamoDBService::batch_get(
+    const std::vector<std::string> &cache_keys) const
+{
+    const std::span<const std::string> all(cache_keys);
+
+    // BatchGetItem takes at most 100 keys; fetch the chunks concurrently
+    std::vector<std::future<CreationMap>> chunks;
+    for (std::size_t offset = 0; offset < all.size(); offset += MAX_BATCH_GET)
+    {
+        const auto chunk = all.subspan(offset, std::min(MAX_BATCH_GET, all.size() - offset));
+        chunks.push_back(std::async(std::launch::async,
+                                    [this, chunk]
+                                    { return batch_get_chunk(chunk); }));
+    }
+
+    CreationMap result;
+    result.reserve(cache_keys.size());
+    for (auto &chunk : chunks)
+    {
+        result.merge(chunk.get());
+    }
+    return result;
+}
+
+DynamoDBService::CreationMap DynamoDBService::batch_get_chunk(
+    std::span<const std::string> cache_keys) const
+{
+    using namespace Aws::DynamoDB::Model;
+
+    KeysAndAttributes pending = projection();
+    for (const auto &key : cache_keys)
+    {
+        auto [creation_id, user_id] = split_cache_key(key);
+        if (creation_id.empty() || user_id.empty())
+        {
+            continue; // Cannot exist, and would fail the whole batch with a ValidationException
+        }
+
+        Aws::Map<Aws::String, AttributeValue> item_key;
+        item_key["creation_id"].SetS(std::move(creation_id));
+        item_key["user_id"].SetS(std::move(user_id));
+        pending.AddKeys(std::move(item_key));
+    }
+
+    CreationMap result;
+    result.reserve(cache_keys.size());
+    if (pending.GetKeys().empty())
+    {
+        return result;
+    }
+
+    for (int attempt = 0; attempt < MAX_BATCH_GET_ATTEMPTS; ++attempt)
+    {
+        if (attempt > 0)
+        {
+            backoff(attempt);
+        }
+
+        BatchGetItemRequest request;
+        request.AddRequestItems(table_name_, pending);
+
+        const auto outcome = client_.BatchGetItem(request);
+        if (!outcome.IsSuccess())
+        {
+            throw std::runtime_error("Failed to get creations: " +
+                                     outcome.GetError().GetMessage());
+        }
+
+        const auto &responses = outcome.GetResult().GetResponses();
+        const auto items = responses.find(table_name_);
+        if (items != responses.end())
+        {
+            for (const auto &item : items->second)
+            {
+                auto creation = std::make_shared<Creation>();
+                if (!creation_schema::from_attribute_map(item, *creation))
+                {
+                    // Served with the unreadable value zeroed rather than failing the chunk
+                    AWS_LOGSTREAM_WARN("DynamoDBService",
+                                       "Malformed attribute in creation " << creation->creation_id);
+                }
+                std::string key = cache_key(creation->creation_id, creation->user_id);
+                result.emplace(std::move(key), std::move(creation));
+            }
+        }
+
+        // Throttled or oversized batches come back partially; retry the rest
+        const auto &unprocessed = outcome.GetResult().GetUnprocessedKeys();
+        const auto remaining = unprocessed.find(table_name_);
+        if (remaining == unprocessed.end() || remaining->second.GetKeys().empty())
+        {
+            return result;
+        }
+
+        AWS_LOGSTREAM_WARN("DynamoDBService",
+                           "Retrying " << remaining->second.GetKeys().size() << " unprocessed keys");
+        pending = remaining->second;
+    }
+
+    throw std::runtime_error("Failed to get creations: keys still unprocessed after retries");
+}
@@ -1,7 +1,14 @@
 #pragma once
 #include <aws/dynamodb/DynamoDBClient.h>
 #include "../models/creation.hpp"
+#include "read_through_cache.hpp"
 #include <aws/core/utils/logging/LogMacros.h>
+#include <chrono>
+#include <memory>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 class DynamoDBService
 {
@@ -10,11 +17,15 @@ public:
      * @brief Construct a new DynamoDB Service
      * @param client Reference to AWS DynamoDB client
      * @param table_name Name of the DynamoDB table
+     * @param cache_ttl How long get_creations() serves an item from memory
+     * @param cache_capacity Maximum number of cached items
      * @throws None Constructor is noexcept
      */
     explicit DynamoDBService(
         const Aws::DynamoDB::DynamoDBClient &client,
-        std::string_view table_name) noexcept;
+        std::string_view table_name,
+        std::chrono::milliseconds cache_ttl = std::chrono::seconds(30),
+        std::size_t cache_capacity = 10000) noexcept;
 
     /**
      * @brief Save a creation to DynamoDB
@@ -24,7 +35,26 @@ public:
      */
     bool save_creation(const Creation &creation) const;
 
+    /**
+     * @brief Fetch many creations with BatchGetItem behind a read-through cache
+     * @param keys Primary keys to fetch; duplicates are fetched once
+     * @return One entry per key, in order; nullptr if the creation does not exist
+     *         (including keys with an empty part, which are never sent)
+     * @throws std::runtime_error if a batch fails or keys stay unprocessed after retries
+     *
+     * Cache misses are split into 100-key BatchGetItem calls that run
+     * concurrently. Concurrent callers missing on the same key share one read.
+     */
+    std::vector<std::shared_ptr<const Creation>> get_creations(
+        std::span<const CreationKey> keys) const;
+
 private:
+    using CreationMap = std::unordered_map<std::string, std::shared_ptr<const Creation>>;
+
+    CreationMap batch_get(const std::vector<std::string> &cache_keys) const;
+    CreationMap batch_get_chunk(std::span<const std::string> cache_keys) const;
+
     const Aws::DynamoDB::DynamoDBClient &client_;
     const std::string table_name_;
+    mutable ReadThroughCache<std::shared_ptr<const Creation>> cache_;
 };
\ No newline at end of file
@@ -0,0 +1,652 @@
+#include "feed_service.hpp"
+#include "../models/creation_schema.hpp"
+#include <aws/dynamodb/model/BatchWriteItemRequest.h>
+#include <aws/dynamodb/model/GetItemRequest.h>
+#include <aws/dynamodb/model/PutItemRequest.h>
+#include <aws/dynamodb/model/QueryRequest.h>
+#include <aws/dynamodb/model/ScanRequest.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+    using Aws::DynamoDB::Model::AttributeValue;
+    using AttributeMap = Aws::Map<Aws::String, AttributeValue>;
+
+    constexpr char LEADERBOARD_PREFIX[] = "LEADERBOARD#";
+    constexpr char LEADERBOARD_SORT_KEY[] = "TOP";
+    constexpr char LEADERBOARD_SERVED[] = "served"; // N the board was written with
+    constexpr char RECENT_PREFIX[] = "RECENT#";
+    constexpr char ELEMENT_INDEX_NAME[] = "ElementNameIndex";
+    constexpr std::size_t LEADERBOARD_BUFFER_FACTOR = 2; // Stored entries per served entry
+    constexpr std::size_t BUCKET_LENGTH = 13; // yyyy-mm-ddThh
+    constexpr std::size_t MAX_BATCH_WRITE = 25;
+    constexpr int MAX_WRITE_ATTEMPTS = 5;
+    constexpr int MAX_LEADERBOARD_ATTEMPTS = 5;
+
+    AttributeValue string_value(const std::string &value)
+    {
+        AttributeValue attribute;
+        attribute.SetS(value);
+        return attribute;
+    }
+
+    AttributeValue number_value(long long value)
+    {
+        AttributeValue attribute;
+        attribute.SetN(std::to_string(value));
+        return attribute;
+    }
+
+    // Card attributes of a creation, aliased like DynamoDBService's projection
+    // since some names may collide with DynamoDB reserved words
+    template <typename Request>
+    void project_card(Request &request)
+    {
+        Aws::String expression;
+        const auto names = creation_schema::field_names(creation_schema::FEED);
+        for (std::size_t i = 0; i < names.size(); ++i)
+        {
+            const Aws::String alias = "#f" + std::to_string(i);
+            expression += (i == 0 ? "" : ", ") + alias;
+            request.AddExpressionAttributeNames(alias, names[i]);
+        }
+        request.SetProjectionExpression(expression);
+    }
+
+    // Card fields of an NPUCreations item; an unreadable score is ranked as 0
+    FeedEntry card_from_creation(const AttributeMap &item)
+    {
+        FeedEntry entry;
+        if (!creation_schema::from_attribute_map(item, entry, creation_schema::FEED))
+        {
+            AWS_LOGSTREAM_WARN("FeedService", "Malformed card attribute in creation " << entry.creation_id);
+        }
+        return entry;
+    }
+
+    // Feed items are written by to_feed_item() only, so they always decode
+    template <typename Map>
+    FeedEntry from_item(const Map &item)
+    {
+        FeedEntry entry;
+        creation_schema::from_feed_item(item, entry);
+        return entry;
+    }
+
+    std::shared_ptr<AttributeValue> to_map_value(const FeedEntry &entry)
+    {
+        Aws::Map<Aws::String, const std::shared_ptr<AttributeValue>> fields;
+        for (auto &field : creation_schema::to_feed_item(entry))
+        {
+            fields.emplace(field.first,
+                           Aws::MakeShared<AttributeValue>("FeedEntry", std::move(field.second)));
+        }
+
+        auto value = Aws::MakeShared<AttributeValue>("FeedEntry");
+        value->SetM(fields);
+        return value;
+    }
+
+    std::string recent_sort_key(const FeedEntry &entry)
+    {
+        return entry.creation_date + "#" + entry.creation_id;
+    }
+
+    Aws::DynamoDB::Model::WriteRequest put_recent_request(const FeedEntry &entry)
+    {
+        using namespace Aws::DynamoDB::Model;
+
+        AttributeMap item = creation_schema::to_feed_item(entry);
+        item.emplace("pk", string_value(RECENT_PREFIX + FeedService::recent_bucket(entry.creation_date)));
+        item.emplace("sk", string_value(recent_sort_key(entry)));
+        return WriteRequest().WithPutRequest(PutRequest().WithItem(item));
+    }
+
+    bool ranks_before(const FeedEntry &lhs, const FeedEntry &rhs)
+    {
+        if (lhs.scores.total_score != rhs.scores.total_score)
+        {
+            return lhs.scores.total_score > rhs.scores.total_score;
+        }
+        return lhs.creation_date > rhs.creation_date;
+    }
+
+    // Replace each record's creation with its new image, or drop it
+    void merge_records(std::vector<FeedEntry> &entries,
+                       const std::string &element_name,
+                       const std::vector<const CreationStreamRecord *> &records)
+    {
+        for (const auto *record : records)
+        {
+            const std::string &creation_id = record->has_new_image
+                                                 ? record->new_image.creation_id
+                                                 : record->old_image.creation_id;
+            entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                         [&creation_id](const FeedEntry &entry)
+                                         { return entry.creation_id == creation_id; }),
+                          entries.end());
+
+            if (record->event_type != CreationStreamRecord::EventType::Remove &&
+                record->has_new_image &&
+                record->new_image.element_name == element_name)
+            {
+                entries.push_back(record->new_image);
+            }
+        }
+    }
+
+    // Sort and keep `capacity` entries. `cutoff` tracks the best entry ever
+    // dropped: a creation that is not stored may rank anywhere below it.
+    void rank_entries(std::vector<FeedEntry> &entries,
+                      std::optional<FeedEntry> &cutoff,
+                      std::size_t capacity)
+    {
+        std::stable_sort(entries.begin(), entries.end(), ranks_before);
+        if (entries.size() > capacity)
+        {
+            if (!cutoff || ranks_before(entries[capacity], *cutoff))
+            {
+                cutoff = entries[capacity];
+            }
+            entries.resize(capacity);
+        }
+    }
+
+    // Number of leading entries no unstored creation can outrank
+    std::size_t exact_prefix(const std::vector<FeedEntry> &entries,
+                             const std::optional<FeedEntry> &cutoff)
+    {
+        if (!cutoff)
+        {
+            return entries.size();
+        }
+        return static_cast<std::size_t>(
+            std::partition_point(entries.begin(), entries.end(),
+                                 [&cutoff](const FeedEntry &entry)
+                                 { return ranks_before(entry, *cutoff); }) -
+            entries.begin());
+    }
+}
+
+FeedService::FeedService(
+    const Aws::DynamoDB::DynamoDBClient &client,
+    std::string_view table_name,
+    std::size_t leaderboard_size,
+    std::string_view source_table_name) noexcept
+    : client_(client), table_name_(table_name), leaderboard_size_(leaderboard_size),
+      source_table_name_(source_table_name) {}
+
+bool FeedService::apply(const std::vector<CreationStreamRecord> &records) const
+{
+    try
+    {
+        if (!write_recent_items(records))
+        {
+            return false;
+        }
+
+        // Group by element so each leaderboard is read and written once per batch.
+        // A record that moves a creation between elements touches both boards.
+        std::map<std::string, std::vector<const CreationStreamRecord *>> by_element;
+        for (const auto &record : records)
+        {
+            if (record.has_new_image && !record.new_image.element_name.empty())
+            {
+                by_element[record.new_image.element_name].push_back(&record);
+            }
+            if (record.has_old_image && !record.old_image.element_name.empty() &&
+                (!record.has_new_image || record.old_image.element_name != record.new_image.element_name))
+            {
+                by_element[record.old_image.element_name].push_back(&record);
+            }
+        }
+
+        bool success = true;
+        for (const auto &[element_name, element_records] : by_element)
+        {
+            success = update_leaderboard(element_name, element_records) && success;
+        }
+        return success;
+    }
+    catch (const std::exception &e)
+    {
+        AWS_LOGSTREAM_ERROR("FeedService",
+                            "Exception while applying stream records: " << e.what());
+        return false;
+    }
+}
+
+FeedService::SeedReport FeedService::seed(std::string_view oldest_bucket) const
+{
+    using namespace Aws::DynamoDB::Model;
+
+    if (source_table_name_.empty())
+    {
+        throw std::invalid_argument("Seeding the feed needs the source table name");
+    }
+
+    ScanRequest request;
+    request.SetTableName(source_table_name_);
+    project_card(request);
+
+    SeedReport report;
+    std::set<std::string> elements;
+    for (;;)
+    {
+        const auto outcome = client_.Scan(request);
+        if (!outcome.IsSuccess())
+        {
+            throw std::runtime_error("Failed to scan " + source_table_name_ + ": " +
+                                     outcome.GetError().GetMessage());
+        }
+
+        // Written page by page so memory stays bounded by the page, not the table
+        Aws::Vector<WriteRequest> requests;
+        for (const auto &item : outcome.GetResult().GetItems())
+        {
+            const FeedEntry entry = card_from_creation(item);
+            ++report.scanned;
+            if (!entry.element_name.empty())
+            {
+                elements.insert(entry.element_name);
+            }
+            if (!entry.creation_date.empty() && recent_bucket(entry.creation_date) >= oldest_bucket)
+            {
+                requests.push_back(put_recent_request(entry));
+            }
+        }
+        const std::size_t count = requests.size();
+        if (batch_write(std::move(requests)))
+        {
+            report.recent += count;
+        }
+        else
+        {
+            ++report.failed;
+        }
+
+        const auto &last_key = outcome.GetResult().GetLastEvaluatedKey();
+        if (last_key.empty())
+        {
+            break;
+        }
+        request.SetExclusiveStartKey(last_key);
+    }
+
+    for (const auto &element_name : elements)
+    {
+        if (update_leaderboard(element_name, {}, true))
+        {
+            ++report.leaderboards;
+        }
+        else
+        {
+            ++report.failed;
+        }
+    }
+    return report;
+}
+
+bool FeedService::write_recent_items(const std::vector<CreationStreamRecord> &records) const
+{
+    using namespace Aws::DynamoDB::Model;
+
+    // BatchWriteItem rejects duplicate keys in one request, so collapse the
+    // batch to the last operation per key.
+    std::map<std::string, WriteRequest> operations;
+
+    for (const auto &record : records)
+    {
+        const bool keeps_item = record.event_type != CreationStreamRecord::EventType::Remove &&
+                                record.has_new_image;
+
+        if (record.has_old_image && !record.old_image.creation_date.empty() &&
+            (!keeps_item || recent_sort_key(record.old_image) != recent_sort_key(record.new_image)))
+        {
+            const std::string pk = RECENT_PREFIX + recent_bucket(record.old_image.creation_date);
+            const std::string sk = recent_sort_key(record.old_image);
+
+            AttributeMap key;
+            key.emplace("pk", string_value(pk));
+            key.emplace("sk", string_value(sk));
+            operations[pk + '\n' + sk] = WriteRequest().WithDeleteRequest(DeleteRequest().WithKey(key));
+        }
+
+        if (keeps_item && !record.new_image.creation_date.empty())
+        {
+            const std::string pk = RECENT_PREFIX + recent_bucket(record.new_image.creation_date);
+            operations[pk + '\n' + recent_sort_key(record.new_image)] = put_recent_request(record.new_image);
+        }
+    }
+
+    Aws::Vector<WriteRequest> requests;
+    requests.reserve(operations.size());
+    for (auto &operation : operations)
+    {
+        requests.push_back(std::move(operation.second));
+    }
+    return batch_write(std::move(requests));
+}
+
+bool FeedService::batch_write(Aws::Vector<Aws::DynamoDB::Model::WriteRequest> requests) const
+{
+    using namespace Aws::DynamoDB::Model;
+
+    for (std::size_t offset = 0; offset < requests.size(); offset += MAX_BATCH_WRITE)
+    {
+        const auto first = requests.begin() + static_cast<std::ptrdiff_t>(offset);
+        const auto last = requests.begin() +
+                          static_cast<std::ptrdiff_t>(std::min(offset + MAX_BATCH_WRITE, requests.size()));
+        Aws::Vector<WriteRequest> pending(first, last);
+
+        for (int attempt = 0; !pending.empty(); ++attempt)
+        {
+            if (attempt == MAX_WRITE_ATTEMPTS)
+            {
+                AWS_LOGSTREAM_ERROR("FeedService",
+                                    "Giving up on " << pending.size() << " unprocessed feed writes");
+                return false;
+            }
+            if (attempt > 0)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50 << attempt));
+            }
+
+            BatchWriteItemRequest request;
+            request.AddRequestItems(table_name_, pending);
+
+            const auto outcome = client_.BatchWriteItem(request);
+            if (!outcome.IsSuccess())
+            {
+                AWS_LOGSTREAM_ERROR("FeedService",
+                                    "Failed to write feed items: " << outcome.GetError().GetMessage());
+                return false;
+            }
+
+            const auto &unprocessed = outcome.GetResult().GetUnprocessedItems();
+            const auto it = unprocessed.find(table_name_);
+            pending = it == unprocessed.end() ? Aws::Vector<WriteRequest>() : it->second;
+        }
+    }
+    return true;
+}
+
+bool FeedService::update_leaderboard(
+    const std::string &element_name,
+    const std::vector<const CreationStreamRecord *> &records,
+    bool rebuild) const
+{
+    using namespace Aws::DynamoDB::Model;
+
+    const std::string pk = LEADERBOARD_PREFIX + element_name;
+
+    // Optimistic concurrency: shards are processed in parallel, so two
+    // invocations may race on the same element. The version check makes the
+    // loser re-read and re-merge instead of overwriting.
+    for (int attempt = 0; attempt < MAX_LEADERBOARD_ATTEMPTS; ++attempt)
+    {
+        GetItemRequest get_request;
+        get_request.SetTableName(table_name_);
+        get_request.AddKey("pk", string_value(pk));
+        get_request.AddKey("sk", string_value(LEADERBOARD_SORT_KEY));
+        get_request.SetConsistentRead(true);
+
+        const auto get_outcome = client_.GetItem(get_request);
+        if (!get_outcome.IsSuccess())
+        {
+            AWS_LOGSTREAM_ERROR("FeedService",
+                                "Failed to read leaderboard for " << element_name << ": "
+                                                                  << get_outcome.GetError().GetMessage());
+            return false;
+        }
+
+        long long version = 0;
+        std::vector<FeedEntry> entries;
+        std::optional<FeedEntry> cutoff;
+        const auto &current = get_outcome.GetResult().GetItem();
+        if (!current.empty())
+        {
+            creation_schema::parse_number(current.at("version").GetN(), version);
+            const auto stored = current.at("entries").GetL();
+            entries.reserve(stored.size() + records.size());
+            for (const auto &value : stored)
+            {
+                entries.push_back(from_item(value->GetM()));
+            }
+
+            const auto stored_cutoff = current.find("cutoff");
+            if (stored_cutoff != current.end())
+            {
+                cutoff = from_item(stored_cutoff->second.GetM());
+            }
+        }
+
+        const std::size_t capacity = leaderboard_size_ * LEADERBOARD_BUFFER_FACTOR;
+        merge_records(entries, element_name, records);
+        rank_entries(entries, cutoff, capacity);
+
+        // Removals and score drops have used up the hidden half, or seed()
+        // asked for it: rebuild from the source table, then re-apply this
+        // batch in case the index lags.
+        if (!source_table_name_.empty() &&
+            (rebuild || (cutoff && exact_prefix(entries, cutoff) < leaderboard_size_)))
+        {
+            AWS_LOGSTREAM_INFO("FeedService",
+                               "Rebuilding leaderboard for " << element_name << " from " << ELEMENT_INDEX_NAME);
+            cutoff.reset();
+            entries = load_element_ranking(element_name, capacity, cutoff);
+            merge_records(entries, element_name, records);
+            rank_entries(entries, cutoff, capacity);
+        }
+
+        Aws::Vector<std::shared_ptr<AttributeValue>> entry_list;
+        entry_list.reserve(entries.size());
+        for (const auto &entry : entries)
+        {
+            entry_list.push_back(to_map_value(entry));
+        }
+
+        AttributeValue entries_value;
+        entries_value.SetL(std::move(entry_list));
+
+        PutItemRequest put_request;
+        put_request.SetTableName(table_name_);
+        put_request.AddItem("pk", string_value(pk));
+        put_request.AddItem("sk", string_value(LEADERBOARD_SORT_KEY));
+        put_request.AddItem("entries", entries_value);
+        put_request.AddItem(LEADERBOARD_SERVED, number_value(static_cast<long long>(leaderboard_size_)));
+        if (cutoff)
+        {
+            put_request.AddItem("cutoff", *to_map_value(*cutoff));
+        }
+        put_request.AddItem("version", number_value(version + 1));
+        put_request.SetConditionExpression("attribute_not_exists(pk) OR #version = :expected");
+        put_request.AddExpressionAttributeNames("#version", "version");
+        put_request.AddExpressionAttributeValues(":expected", number_value(version));
+
+        const auto put_outcome = client_.PutItem(put_request);
+        if (put_outcome.IsSuccess())
+        {
+            return true;
+        }
+
+        if (put_outcome.GetError().GetErrorType() !=
+            Aws::DynamoDB::DynamoDBErrors::CONDITIONAL_CHECK_FAILED)
+        {
+            AWS_LOGSTREAM_ERROR("FeedService",
+                                "Failed to write leaderboard for " << element_name << ": "
+                                                                   << put_outcome.GetError().GetMessage());
+            return false;
+        }
+
+        AWS_LOGSTREAM_WARN("FeedService",
+                           "Leaderboard for " << element_name << " changed concurrently, retrying");
+    }
+
+    AWS_LOGSTREAM_ERROR("FeedService",
+                        "Giving up on leaderboard update for " << element_name);
+    return false;
+}
+
+std::vector<FeedEntry> FeedService::get_top_creations(
+    std::string_view element_name,
+    std::size_t page_size) const
+{
+    using namespace Aws::DynamoDB::Model;
+
+    GetItemRequest request;
+    request.SetTableName(table_name_);
+    request.AddKey("pk", string_value(LEADERBOARD_PREFIX + std::string(element_name)));
+    request.AddKey("sk", string_value(LEADERBOARD_SORT_KEY));
+    request.SetProjectionExpression(std::string("entries, ") + LEADERBOARD_SERVED);
+
+    const auto outcome = client_.GetItem(request);
+    if (!outcome.IsSuccess())
+    {
+        throw std::runtime_error("Failed to read leaderboard: " +
+                                 outcome.GetError().GetMessage());
+    }
+
+    std::vector<FeedEntry> result;
+    const auto &item = outcome.GetResult().GetItem();
+    const auto entries = item.find("entries");
+    if (entries == item.end())
+    {
+        return result;
+    }
+
+    // Entries past the served size are the hidden buffer and never served.
+    // The writer records that size, so readers need no configuration of
+    // their own; boards written before it was recorded hold 2N entries.
+    const auto stored = entries->second.GetL();
+    const auto served = item.find(LEADERBOARD_SERVED);
+    std::size_t served_size = stored.size() / LEADERBOARD_BUFFER_FACTOR;
+    long long value = 0;
+    if (served != item.end() && creation_schema::parse_number(served->second.GetN(), value))
+    {
+        served_size = static_cast<std::size_t>(std::max(value, 0LL));
+    }
+    const std::size_t count = std::min({page_size, served_size, stored.size()});
+    result.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        result.push_back(from_item(stored[i]->GetM()));
+    }
+    return result;
+}
+
+std::vector<FeedEntry> FeedService::load_element_ranking(
+    const std::string &element_name,
+    std::size_t limit,
+    std::optional<FeedEntry> &cutoff) const
+{
+    using namespace Aws::DynamoDB::Model;
+
+    QueryRequest request;
+    request.SetTableName(source_table_name_);
+    request.SetIndexName(ELEMENT_INDEX_NAME);
+    request.SetKeyConditionExpression("element_name = :element");
+    request.AddExpressionAttributeValues(":element", string_value(element_name));
+    project_card(request);
+
+    // Keep only the best `limit` entries between pages so memory stays bounded
+    std::vector<FeedEntry> ranking;
+    for (;;)
+    {
+        const auto outcome = client_.Query(request);
+        if (!outcome.IsSuccess())
+        {
+            throw std::runtime_error("Failed to query " + std::string(ELEMENT_INDEX_NAME) + ": " +
+                                     outcome.GetError().GetMessage());
+        }
+
+        for (const auto &item : outcome.GetResult().GetItems())
+        {
+            ranking.push_back(card_from_creation(item));
+        }
+        rank_entries(ranking, cutoff, limit);
+
+        const auto &last_key = outcome.GetResult().GetLastEvaluatedKey();
+        if (last_key.empty())
+        {
+            return ranking;
+        }
+        request.SetExclusiveStartKey(last_key);
+    }
+}
+
+FeedService::RecentPage FeedService::get_recent_creations(
+    std::string_view bucket,
+    std::string_view exclusive_start,
+    std::size_t page_size) const
+{
+    using namespace Aws::DynamoDB::Model;
+
+    const std::string pk = RECENT_PREFIX + std::string(bucket);
+
+    QueryRequest request;
+    request.SetTableName(table_name_);
+    request.SetKeyConditionExpression("pk = :pk");
+    request.AddExpressionAttributeValues(":pk", string_value(pk));
+    request.SetScanIndexForward(false);
+    request.SetLimit(static_cast<int>(page_size));
+    if (!exclusive_start.empty())
+    {
+        request.AddExclusiveStartKey("pk", string_value(pk));
+        request.AddExclusiveStartKey("sk", string_value(std::string(exclusive_start)));
+    }
+
+    const auto outcome = client_.Query(request);
+    if (!outcome.IsSuccess())
+    {
+        throw std::runtime_error("Failed to query recent feed: " +
+                                 outcome.GetError().GetMessage());
+    }
+
+    RecentPage page;
+    const auto &items = outcome.GetResult().GetItems();
+    page.items.reserve(items.size());
+    for (const auto &item : items)
+    {
+        page.items.push_back(from_item(item));
+    }
+
+    const auto &last_key = outcome.GetResult().GetLastEvaluatedKey();
+    const auto last_sk = last_key.find("sk");
+    if (last_sk != last_key.end())
+    {
+        page.bucket = std::string(bucket);
+        page.last_sort_key = last_sk->second.GetS();
+    }
+    else
+    {
+        page.bucket = previous_bucket(bucket);
+    }
+    return page;
+}
+
+std::string FeedService::recent_bucket(std::string_view creation_date)
+{
+    return std::string(creation_date.substr(0, BUCKET_LENGTH));
+}
+
+std::string FeedService::previous_bucket(std::string_view bucket)
+{
+    const Aws::Utils::DateTime start(std::string(bucket) + ":00:00Z",
+                                     Aws::Utils::DateFormat::ISO_8601);
+    if (!start.WasParseSuccessful())
+    {
+        throw std::invalid_argument("Invalid feed bucket: " + std::string(bucket));
+    }
+
+    constexpr int64_t HOUR_MS = 60 * 60 * 1000;
+    return Aws::Utils::DateTime(start.Millis() - HOUR_MS).ToGmtString("%Y-%m-%dT%H");
+}
@@ -0,0 +1,148 @@
+#pragma once
+#include <aws/dynamodb/DynamoDBClient.h>
+#include <aws/dynamodb/model/WriteRequest.h>
+#include <optional>
+#include <string_view>
+#include <vector>
+#include "../models/feed_entry.hpp"
+#include "../models/stream_record.hpp"
+
+/**
+ * @brief Maintains and serves the precomputed feed views
+ *
+ * The feed table (pk/sk string keys) holds two kinds of items:
+ * - `LEADERBOARD#<element_name>` / `TOP`: the top creations of an element
+ *   by total score, stored as a single list so a page costs one GetItem.
+ *   The list keeps 2N entries and only the first N are served, so removals
+ *   and score drops are backfilled from the hidden half. N is stored with
+ *   the list, so only the writer needs to know it.
+ * - `RECENT#<yyyy-mm-ddThh>` / `<creation_date>#<creation_id>`: one item per
+ *   creation in hourly buckets, so a page costs one Query and writes spread
+ *   over time instead of landing on a single "recent" partition.
+ */
+class FeedService
+{
+public:
+    /**
+     * @brief Construct a new Feed Service
+     * @param client Reference to AWS DynamoDB client
+     * @param table_name Name of the feed table
+     * @param leaderboard_size Number of entries served per element leaderboard
+     *        when writing one; readers use the size stored with each board
+     * @param source_table_name NPUCreations table, used to rebuild a leaderboard
+     *        whose hidden buffer has run out; empty for read-only use
+     */
+    explicit FeedService(
+        const Aws::DynamoDB::DynamoDBClient &client,
+        std::string_view table_name,
+        std::size_t leaderboard_size,
+        std::string_view source_table_name = {}) noexcept;
+
+    /**
+     * @brief Page of the recent feed
+     *
+     * When `last_sort_key` is empty the bucket is exhausted and `bucket`
+     * already points to the previous hour.
+     */
+    struct RecentPage
+    {
+        std::vector<FeedEntry> items;
+        std::string bucket;
+        std::string last_sort_key;
+    };
+
+    /**
+     * @brief What seed() wrote
+     */
+    struct SeedReport
+    {
+        std::size_t scanned = 0;      // Creations read from the source table
+        std::size_t recent = 0;       // Recent feed items written
+        std::size_t leaderboards = 0; // Leaderboards rebuilt
+        std::size_t failed = 0;       // Write batches and leaderboards that could not be written
+    };
+
+    /**
+     * @brief Apply a batch of NPUCreations changes to the feed views
+     * @param records Decoded stream records, in stream order
+     * @return true if every view was updated, false otherwise
+     * @throws None Method handles all exceptions internally
+     *
+     * All writes are idempotent, so a failed batch can be retried as a whole.
+     */
+    bool apply(const std::vector<CreationStreamRecord> &records) const;
+
+    /**
+     * @brief Build the feed views from the source table
+     * @param oldest_bucket Oldest hour bucket copied into the recent feed
+     * @throws std::runtime_error if the source table cannot be read
+     * @throws std::invalid_argument if the service has no source table
+     *
+     * For a feed table created after the source table already has items: the
+     * stream only carries later changes. Every leaderboard is rebuilt from
+     * ElementNameIndex under the same version check as apply(), so it is safe
+     * to run while the projector is live.
+     */
+    SeedReport seed(std::string_view oldest_bucket) const;
+
+    /**
+     * @brief Read the highest scored creations of an element
+     * @param element_name Element to read the leaderboard of
+     * @param page_size Maximum number of entries to return, capped at the stored board size
+     * @throws std::runtime_error if the read fails
+     */
+    std::vector<FeedEntry> get_top_creations(
+        std::string_view element_name,
+        std::size_t page_size) const;
+
+    /**
+     * @brief Read a page of the recent feed, newest first
+     * @param bucket Hour bucket to read, see recent_bucket()
+     * @param exclusive_start Sort key to continue after, empty for the first page
+     * @param page_size Maximum number of entries to return
+     * @throws std::runtime_error if the query fails
+     */
+    RecentPage get_recent_creations(
+        std::string_view bucket,
+        std::string_view exclusive_start,
+        std::size_t page_size) const;
+
+    /**
+     * @brief Hour bucket of an ISO 8601 creation date (`yyyy-mm-ddThh`)
+     */
+    static std::string recent_bucket(std::string_view creation_date);
+
+    /**
+     * @brief Hour bucket preceding the given one
+     */
+    static std::string previous_bucket(std::string_view bucket);
+
+private:
+    bool write_recent_items(const std::vector<CreationStreamRecord> &records) const;
+
+    bool batch_write(Aws::Vector<Aws::DynamoDB::Model::WriteRequest> requests) const;
+
+    /**
+     * @param rebuild Reload the board from ElementNameIndex even if the stored one is exact
+     */
+    bool update_leaderboard(
+        const std::string &element_name,
+        const std::vector<const CreationStreamRecord *> &records,
+        bool rebuild = false) const;
+
+    /**
+     * @brief Rank every creation of an element from ElementNameIndex
+     * @param cutoff Set to the best creation beyond `limit`, if any
+     * @return The best `limit` entries, sorted
+     * @throws std::runtime_error if the query fails
+     */
+    std::vector<FeedEntry> load_element_ranking(
+        const std::string &element_name,
+        std::size_t limit,
+        std::optional<FeedEntry> &cutoff) const;
+
+    const Aws::DynamoDB::DynamoDBClient &client_;
+    const std::string table_name_;
+    const std::size_t leaderboard_size_;
+    const std::string source_table_name_;
+};
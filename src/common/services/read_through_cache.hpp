@@ -0,0 +1,197 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @brief Thread-safe TTL cache that loads misses in bulk and coalesces them
+ *
+ * When several callers miss on the same key at once, only the first one
+ * loads it; the others wait for that load instead of issuing their own.
+ * Keys the loader does not return are cached as a default-constructed
+ * Value, so repeated lookups of a missing key are also absorbed. Beyond
+ * `capacity` entries the least recently used ones are evicted, in O(1) each.
+ */
+template <typename Value>
+class ReadThroughCache
+{
+public:
+    /**
+     * @brief Loads a batch of keys; keys absent from the result do not exist
+     */
+    using Loader = std::function<std::unordered_map<std::string, Value>(const std::vector<std::string> &)>;
+
+    ReadThroughCache(std::chrono::milliseconds ttl, std::size_t capacity) noexcept
+        : ttl_(ttl), capacity_(capacity) {}
+
+    /**
+     * @brief Look up keys, loading the ones that are neither cached nor in flight
+     * @return Values in the order of `keys`
+     * @throws Whatever the loader throws, in this and in every coalesced caller
+     */
+    std::vector<Value> get(const std::vector<std::string> &keys, const Loader &load)
+    {
+        std::unordered_map<std::string, Value> found;
+        std::vector<std::string> to_load;
+        std::vector<std::promise<Value>> promises;
+        std::vector<std::pair<std::string, std::shared_future<Value>>> waiting;
+        std::unordered_set<std::string> seen;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            const auto now = Clock::now();
+
+            for (const auto &key : keys)
+            {
+                if (!seen.insert(key).second)
+                {
+                    continue; // Duplicate within this call
+                }
+
+                const auto cached = entries_.find(key);
+                if (cached != entries_.end())
+                {
+                    if (cached->second.expires > now)
+                    {
+                        recency_.splice(recency_.begin(), recency_, cached->second.position);
+                        found.emplace(key, cached->second.value);
+                        continue;
+                    }
+                    erase(cached);
+                }
+
+                const auto loading = in_flight_.find(key);
+                if (loading != in_flight_.end())
+                {
+                    waiting.emplace_back(key, loading->second);
+                    continue;
+                }
+
+                promises.emplace_back();
+                auto future = promises.back().get_future().share();
+                in_flight_.emplace(key, future);
+                waiting.emplace_back(key, std::move(future));
+                to_load.push_back(key);
+            }
+        }
+
+        if (!to_load.empty())
+        {
+            load_and_publish(to_load, promises, load);
+        }
+
+        for (auto &[key, future] : waiting)
+        {
+            found.emplace(key, future.get());
+        }
+
+        std::vector<Value> result;
+        result.reserve(keys.size());
+        for (const auto &key : keys)
+        {
+            result.push_back(found.at(key));
+        }
+        return result;
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry
+    {
+        Value value;
+        Clock::time_point expires;
+        std::list<std::string>::iterator position; // In recency_
+    };
+
+    using EntryMap = std::unordered_map<std::string, Entry>;
+
+    void load_and_publish(const std::vector<std::string> &keys,
+                          std::vector<std::promise<Value>> &promises,
+                          const Loader &load)
+    {
+        std::unordered_map<std::string, Value> loaded;
+        try
+        {
+            loaded = load(keys);
+        }
+        catch (...)
+        {
+            // Fail every caller waiting on these keys and let the next call retry
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                for (const auto &key : keys)
+                {
+                    in_flight_.erase(key);
+                }
+            }
+            for (auto &promise : promises)
+            {
+                promise.set_exception(std::current_exception());
+            }
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            const auto expires = Clock::now() + ttl_;
+            for (const auto &key : keys)
+            {
+                const auto it = loaded.find(key);
+                store(key, it == loaded.end() ? Value() : it->second, expires);
+                in_flight_.erase(key);
+            }
+        }
+
+        for (std::size_t i = 0; i < keys.size(); ++i)
+        {
+            const auto it = loaded.find(keys[i]);
+            promises[i].set_value(it == loaded.end() ? Value() : it->second);
+        }
+    }
+
+    // Insert or refresh an entry as the most recently used, then evict
+    // from the least recently used end down to capacity_. Called with mutex_ held.
+    void store(const std::string &key, Value value, Clock::time_point expires)
+    {
+        const auto existing = entries_.find(key);
+        if (existing != entries_.end())
+        {
+            existing->second.value = std::move(value);
+            existing->second.expires = expires;
+            recency_.splice(recency_.begin(), recency_, existing->second.position);
+        }
+        else
+        {
+            recency_.push_front(key);
+            entries_.emplace(key, Entry{std::move(value), expires, recency_.begin()});
+        }
+
+        while (entries_.size() > capacity_)
+        {
+            entries_.erase(recency_.back());
+            recency_.pop_back();
+        }
+    }
+
+    // Called with mutex_ held
+    void erase(typename EntryMap::iterator entry)
+    {
+        recency_.erase(entry->second.position);
+        entries_.erase(entry);
+    }
+
+    const std::chrono::milliseconds ttl_;
+    const std::size_t capacity_;
+    std::mutex mutex_;
+    EntryMap entries_;
+    std::list<std::string> recency_; // Most recently used first
+    std::unordered_map<std::string, std::shared_future<Value>> in_flight_;
+};
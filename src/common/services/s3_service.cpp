@@ -1,10 +1,33 @@
 #include "s3_service.hpp"
+#include "../../utils/image_processor.hpp"
 #include <aws/s3/model/PutObjectRequest.h>
 #include <aws/s3/model/DeleteObjectRequest.h>
 #include <aws/core/utils/base64/Base64.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <sstream>
+#ifdef NPU_HAVE_JPEG
+#include "../../utils/image_resizer.hpp"
+#endif
+
+namespace
+{
+    Aws::Utils::ByteBuffer decode_base64(std::string_view image_data)
+    {
+        // Remove potential "data:image/jpeg;base64," prefix if present
+        const std::string_view base64_data = image_processor::strip_data_uri(image_data);
+
+        Aws::Utils::Base64::Base64 base64;
+        Aws::Utils::ByteBuffer decoded = base64.Decode(Aws::String(base64_data));
+        if (decoded.GetLength() == 0)
+        {
+            throw std::runtime_error("Failed to decode base64 image data");
+        }
+
+        AWS_LOGSTREAM_INFO("S3Service", "Decoded image size: " << decoded.GetLength() << " bytes");
+        return decoded;
+    }
+}
 
 S3Service::S3Service(
     const Aws::S3::S3Client &client,
@@ -30,12 +53,13 @@ S3Service::UploadResult S3Service::upload_creation_image(
         std::string image_key = std::string("images/") + std::string(creation_id) + ".jpg";
         std::string thumb_key = std::string("thumbnails/") + std::string(creation_id) + ".jpg";
 
-        // Upload original image
-        upload_image(image_key, image_data);
+        const Aws::Utils::ByteBuffer image = decode_base64(image_data);
+
+        // Resize first, so an undecodable image uploads nothing
+        const std::vector<std::uint8_t> thumbnail = create_thumbnail(image);
 
-        // Create and upload thumbnail
-        std::string thumbnail_data = create_thumbnail(image_data);
-        upload_image(thumb_key, thumbnail_data);
+        upload_image(image_key, image.GetUnderlyingData(), image.GetLength());
+        upload_image(thumb_key, thumbnail.data(), thumbnail.size());
 
         return UploadResult{
             .image_key = std::move(image_key),
@@ -51,11 +75,12 @@ S3Service::UploadResult S3Service::upload_creation_image(
 
 std::string S3Service::upload_image(
     std::string_view key,
-    std::string_view image_data) const
+    const std::uint8_t *data,
+    std::size_t size) const
 {
-    AWS_LOGSTREAM_INFO("S3Service", "Uploading image with key: " << key);
+    AWS_LOGSTREAM_INFO("S3Service", "Uploading image with key: " << key << " (" << size << " bytes)");
 
-    if (key.empty() || image_data.empty())
+    if (key.empty() || size == 0)
     {
         throw std::invalid_argument("Empty key or image data");
     }
@@ -65,33 +90,12 @@ std::string S3Service::upload_image(
     request.SetKey(std::string(key));
     request.SetContentType("image/jpeg");
 
-    // Convert base64 to binary
-    Aws::Utils::Base64::Base64 base64;
-    
-    // Remove potential "data:image/jpeg;base64," prefix if present
-    std::string base64Data = std::string(image_data);
-    size_t pos = base64Data.find(",");
-    if (pos != std::string::npos) {
-        base64Data = base64Data.substr(pos + 1);
-    }
-
-    // Decode base64 data
-    Aws::Utils::ByteBuffer decoded = base64.Decode(base64Data);
-
-    if (decoded.GetLength() == 0)
-    {
-        throw std::runtime_error("Failed to decode base64 image data");
-    }
-
-    AWS_LOGSTREAM_INFO("S3Service", "Decoded image size: " << decoded.GetLength() << " bytes");
-
-    // Create input stream from decoded binary data
+    // Create input stream from the binary data
     auto input_data = Aws::MakeShared<Aws::StringStream>("ImageData");
-    input_data->write(reinterpret_cast<const char*>(decoded.GetUnderlyingData()),
-                     static_cast<std::streamsize>(decoded.GetLength()));
+    input_data->write(reinterpret_cast<const char *>(data), static_cast<std::streamsize>(size));
 
     request.SetBody(input_data);
-    request.SetContentLength(static_cast<long>(decoded.GetLength()));
+    request.SetContentLength(static_cast<long>(size));
 
     // Upload to S3
     auto outcome = client_.PutObject(request);
@@ -105,11 +109,16 @@ std::string S3Service::upload_image(
     return std::string(key);
 }
 
-std::string S3Service::create_thumbnail(std::string_view image_data) const
+std::vector<std::uint8_t> S3Service::create_thumbnail(const Aws::Utils::ByteBuffer &image) const
 {
-    // TODO: Implement actual image resizing
-    // For now, return the original image
-    return std::string(image_data);
+#ifdef NPU_HAVE_JPEG
+    return image_processor::resize_jpeg(
+        image.GetUnderlyingData(), image.GetLength(),
+        image_processor::THUMBNAIL_MAX_DIMENSION, image_processor::THUMBNAIL_QUALITY);
+#else
+    // Built without libjpeg: the thumbnail is the original image
+    return std::vector<std::uint8_t>(image.GetUnderlyingData(), image.GetUnderlyingData() + image.GetLength());
+#endif
 }
 
 bool S3Service::validate_image_data(std::string_view image_data) const noexcept
@@ -119,12 +128,10 @@ bool S3Service::validate_image_data(std::string_view image_data) const noexcept
         return false;
     }
 
-    // Convert base64 to binary
-    Aws::Utils::Base64::Base64 base64;
-    Aws::Utils::ByteBuffer decoded = base64.Decode(std::string(image_data));
-
-    // Check if decoding was successful
-    return decoded.GetLength() > 0;
+    // Only the header bytes are decoded; the full decode happens once, on upload.
+    // Keys, Content-Type and thumbnails are JPEG only, so other formats are refused
+    const auto header = image_processor::sniff_base64_image(image_data);
+    return header && header->format == image_processor::ImageFormat::Jpeg;
 }
 
 void S3Service::delete_images(
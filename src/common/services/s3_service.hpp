@@ -1,6 +1,9 @@
 #pragma once
 #include <aws/s3/S3Client.h>
+#include <aws/core/utils/Array.h>
+#include <cstdint>
 #include <string_view>
+#include <vector>
 #include "../models/creation.hpp"
 
 class S3Service {
@@ -47,25 +50,28 @@ public:
 private:
     /**
      * @brief Create a thumbnail from the original image
-     * @param image_data Base64 encoded image data
-     * @return Base64 encoded thumbnail data
+     * @param image Decoded JPEG bytes
+     * @return JPEG thumbnail, longer side at most THUMBNAIL_MAX_DIMENSION
+     * @throws std::runtime_error if the image cannot be decoded
      */
-    std::string create_thumbnail(std::string_view image_data) const;
+    std::vector<std::uint8_t> create_thumbnail(const Aws::Utils::ByteBuffer &image) const;
 
     /**
-     * @brief Upload a single image to S3
+     * @brief Upload a single JPEG to S3
      * @param key S3 object key
-     * @param image_data Base64 encoded image data
+     * @param data Encoded image bytes
+     * @param size Number of bytes in `data`
      * @return S3 object key of uploaded file
      */
     std::string upload_image(
         std::string_view key,
-        std::string_view image_data) const;
+        const std::uint8_t *data,
+        std::size_t size) const;
 
     /**
      * @brief Validate the format of image data
      * @param image_data Base64 encoded image data
-     * @return true if valid, false otherwise
+     * @return true if it is a JPEG, the only format stored and thumbnailed
      */
     bool validate_image_data(std::string_view image_data) const noexcept;
 
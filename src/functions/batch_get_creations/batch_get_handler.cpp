@@ -0,0 +1,138 @@
+#include "batch_get_handler.hpp"
+#include "../../common/models/creation_schema.hpp"
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/platform/Environment.h>
+#include <algorithm>
+
+BatchGetHandler::BatchGetHandler(
+    const DynamoDBService &dynamo_service,
+    const std::string &bucket_name)
+    : dynamo_service_(dynamo_service), bucket_name_(bucket_name)
+{
+}
+
+aws::lambda_runtime::invocation_response
+BatchGetHandler::handle_request(const std::vector<CreationKey> &keys)
+{
+    AWS_LOGSTREAM_INFO("BatchGetCreations", "Hydrating " << keys.size() << " creations");
+
+    try
+    {
+        const auto creations = dynamo_service_.get_creations(keys);
+
+        return aws::lambda_runtime::invocation_response::success(
+            create_response(keys, creations).View().WriteCompact(),
+            "application/json");
+    }
+    catch (const std::exception &e)
+    {
+        AWS_LOGSTREAM_ERROR("BatchGetCreations",
+                            "Failed to get creations: " << e.what());
+        return aws::lambda_runtime::invocation_response::failure(
+            e.what(), "DatabaseError");
+    }
+}
+
+std::vector<CreationKey> BatchGetHandler::parse_request(const Aws::String &request_payload)
+{
+    using namespace Aws::Utils::Json;
+
+    JsonValue json(request_payload);
+    if (!json.WasParseSuccessful())
+    {
+        throw std::runtime_error("Failed to parse input JSON");
+    }
+
+    JsonView view = json.View();
+    if (!view.KeyExists("body"))
+    {
+        throw std::runtime_error("Missing 'body' in request");
+    }
+
+    JsonValue body_json(view.GetString("body"));
+    if (!body_json.WasParseSuccessful())
+    {
+        throw std::runtime_error("Failed to parse body JSON");
+    }
+
+    JsonView json_data = body_json.View();
+    if (!json_data.KeyExists("keys"))
+    {
+        throw std::runtime_error("Missing required fields");
+    }
+
+    const auto keys_array = json_data.GetArray("keys");
+    if (keys_array.GetLength() > MAX_KEYS)
+    {
+        throw std::invalid_argument("Too many keys");
+    }
+
+    std::vector<CreationKey> keys;
+    keys.reserve(keys_array.GetLength());
+    for (size_t i = 0; i < keys_array.GetLength(); ++i)
+    {
+        const JsonView key = keys_array[i];
+        if (!key.KeyExists("creation_id") || !key.KeyExists("user_id"))
+        {
+            throw std::runtime_error("Missing required fields");
+        }
+
+        CreationKey creation_key{key.GetString("creation_id"), key.GetString("user_id")};
+        if (creation_key.creation_id.empty() || creation_key.user_id.empty())
+        {
+            throw std::invalid_argument("Empty creation_id or user_id in key " + std::to_string(i));
+        }
+        keys.push_back(std::move(creation_key));
+    }
+
+    return keys;
+}
+
+Aws::Utils::Json::JsonValue BatchGetHandler::create_response(
+    const std::vector<CreationKey> &keys,
+    const std::vector<std::shared_ptr<const Creation>> &creations) const
+{
+    using namespace Aws::Utils::Json;
+
+    Aws::String region = Aws::Environment::GetEnv("AWS_REGION");
+    if (region.empty())
+    {
+        AWS_LOGSTREAM_ERROR("BatchGetCreations", "AWS_REGION environment variable not set");
+        throw std::runtime_error("AWS_REGION not set");
+    }
+
+    // Construct S3 URLs
+    std::string base_url = "https://" + bucket_name_ + ".s3." +
+                           std::string(region.c_str()) + ".amazonaws.com/";
+
+    const size_t found = static_cast<size_t>(
+        std::count_if(creations.begin(), creations.end(),
+                      [](const auto &creation)
+                      { return creation != nullptr; }));
+
+    // Found creations in request order; keys without an item are listed separately
+    Aws::Utils::Array<JsonValue> items(found);
+    Aws::Utils::Array<JsonValue> missing(creations.size() - found);
+    size_t item_index = 0;
+    size_t missing_index = 0;
+    for (size_t i = 0; i < creations.size(); ++i)
+    {
+        if (!creations[i])
+        {
+            missing[missing_index++]
+                .WithString("creation_id", keys[i].creation_id)
+                .WithString("user_id", keys[i].user_id);
+            continue;
+        }
+
+        JsonValue &item = items[item_index++];
+        creation_schema::to_json(*creations[i], creation_schema::DETAIL, item);
+        item.WithString("image_url", base_url + creations[i]->image_key)
+            .WithString("thumbnail_url", base_url + creations[i]->thumbnail_key);
+    }
+
+    JsonValue response;
+    response.WithArray("items", std::move(items))
+        .WithArray("missing", std::move(missing));
+    return response;
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <aws/lambda-runtime/runtime.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include "../../common/services/dynamodb_service.hpp"
+#include "../../common/models/creation.hpp"
+
+class BatchGetHandler
+{
+public:
+    BatchGetHandler(
+        const DynamoDBService &dynamo_service,
+        const std::string &bucket_name);
+
+    /**
+     * @brief Hydrate a batch of creations in one call
+     * @param keys Keys from parse_request()
+     */
+    aws::lambda_runtime::invocation_response handle_request(
+        const std::vector<CreationKey> &keys);
+
+    /**
+     * @brief Extract the requested keys from an API Gateway event
+     * @throws std::runtime_error if the body is malformed
+     * @throws std::invalid_argument if more than MAX_KEYS keys are requested or a
+     *         key has an empty creation_id or user_id
+     */
+    std::vector<CreationKey> parse_request(const Aws::String &request_payload);
+
+    // Three BatchGetItem chunks fetched concurrently; at the schema's field
+    // limits the response stays around 1 MB, well under Lambda's 6 MB
+    static constexpr std::size_t MAX_KEYS = 300;
+
+private:
+    Aws::Utils::Json::JsonValue create_response(
+        const std::vector<CreationKey> &keys,
+        const std::vector<std::shared_ptr<const Creation>> &creations) const;
+
+    const DynamoDBService &dynamo_service_;
+    std::string bucket_name_;
+};
@@ -0,0 +1,98 @@
+#include <aws/core/Aws.h>
+#include <aws/lambda-runtime/runtime.h>
+#include <aws/core/utils/logging/LogLevel.h>
+#include <aws/core/utils/logging/ConsoleLogSystem.h>
+#include <aws/core/platform/Environment.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/dynamodb/DynamoDBClient.h>
+#include "../../common/services/dynamodb_service.hpp"
+#include "batch_get_handler.hpp"
+
+namespace
+{
+    constexpr char TAG[] = "NPUBatchGetCreations";
+    constexpr char ENV_BUCKET_NAME[] = "BUCKET_NAME";
+    constexpr char ENV_TABLE_NAME[] = "TABLE_NAME";
+    constexpr char ENV_AWS_REGION[] = "AWS_REGION";
+    constexpr char ENV_CACHE_TTL_MS[] = "CACHE_TTL_MS";
+    constexpr char ENV_CACHE_CAPACITY[] = "CACHE_CAPACITY";
+
+    std::function<std::shared_ptr<Aws::Utils::Logging::LogSystemInterface>()>
+    GetConsoleLoggerFactory(Aws::Utils::Logging::LogLevel level)
+    {
+        return [level]
+        {
+            return Aws::MakeShared<Aws::Utils::Logging::ConsoleLogSystem>(
+                "console_logger", level);
+        };
+    }
+
+    Aws::Client::ClientConfiguration CreateClientConfig()
+    {
+        Aws::Client::ClientConfiguration config;
+        config.region = Aws::Environment::GetEnv(ENV_AWS_REGION);
+        config.caFile = "/etc/pki/tls/certs/ca-bundle.crt";
+        config.disableExpectHeader = true;
+        config.connectTimeoutMs = 5000;  // 5 second connection timeout
+        config.requestTimeoutMs = 10000; // 10 second request timeout
+        return config;
+    }
+
+    std::size_t GetEnvNumber(const char *name, std::size_t fallback)
+    {
+        const char *value = std::getenv(name);
+        return value ? std::stoul(value) : fallback;
+    }
+}
+
+using namespace aws::lambda_runtime;
+
+invocation_response my_handler(invocation_request const &request)
+{
+    try
+    {
+        const char *bucket_name = std::getenv(ENV_BUCKET_NAME);
+        const char *table_name = std::getenv(ENV_TABLE_NAME);
+        if (!bucket_name || !table_name)
+        {
+            throw std::runtime_error("Required environment variables not set");
+        }
+
+        // The service and its cache live for the whole container, so warm
+        // invocations are served from memory where possible.
+        static auto config = CreateClientConfig();
+        static Aws::DynamoDB::DynamoDBClient dynamo_client(config);
+        static DynamoDBService dynamo_service(
+            dynamo_client, table_name,
+            std::chrono::milliseconds(GetEnvNumber(ENV_CACHE_TTL_MS, 30000)),
+            GetEnvNumber(ENV_CACHE_CAPACITY, 10000));
+        static BatchGetHandler handler(dynamo_service, bucket_name);
+
+        AWS_LOGSTREAM_INFO(TAG, "Handling request: " << request.request_id);
+
+        const auto keys = handler.parse_request(request.payload);
+        return handler.handle_request(keys);
+    }
+    catch (const std::exception &e)
+    {
+        AWS_LOGSTREAM_ERROR(TAG, "Fatal error: " << e.what());
+        return invocation_response::failure(e.what(), "Exception");
+    }
+}
+
+int main()
+{
+    // Initialize AWS SDK
+    Aws::SDKOptions options;
+    options.loggingOptions.logLevel = Aws::Utils::Logging::LogLevel::Info;
+    options.loggingOptions.logger_create_fn = GetConsoleLoggerFactory(Aws::Utils::Logging::LogLevel::Info);
+    Aws::InitAPI(options);
+    AWS_LOGSTREAM_INFO(TAG, "AWS SDK initialized");
+
+    // Run the handler
+    run_handler(my_handler);
+
+    // Shutdown AWS SDK
+    Aws::ShutdownAPI(options);
+    return 0;
+}
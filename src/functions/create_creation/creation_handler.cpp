@@ -1,4 +1,6 @@
 #include "creation_handler.hpp"
+#include "../../common/models/creation_schema.hpp"
+#include "request_precheck.hpp"
 #include <aws/core/utils/json/JsonSerializer.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/platform/Environment.h>
@@ -6,8 +8,10 @@
 CreationHandler::CreationHandler(
     const DynamoDBService &dynamo_service,
     const S3Service &s3_service,
-    const std::string &bucket_name)
-    : dynamo_service_(dynamo_service), s3_service_(s3_service), bucket_name_(bucket_name)
+    const std::string &bucket_name,
+    const RequestLimits &limits)
+    : dynamo_service_(dynamo_service), s3_service_(s3_service), bucket_name_(bucket_name),
+      limits_(limits)
 {
 }
 
@@ -115,8 +119,15 @@ Creation CreationHandler::parse_request(const Aws::String& request_payload)
 
     Creation creation;
 
-    // Print the raw JSON payload
-    AWS_LOGSTREAM_INFO("CreateCreation", "Raw JSON payload: " << request_payload);
+    // Reject requests over a limit before the event, body or image is copied
+    const auto image = precheck_create_request(
+        std::string_view(request_payload.data(), request_payload.size()), limits_);
+    if (image)
+    {
+        AWS_LOGSTREAM_DEBUG("CreateCreation", "Image header: " << image->width << "x" << image->height);
+    }
+
+    AWS_LOGSTREAM_INFO("CreateCreation", "Payload size: " << request_payload.size() << " bytes");
 
     // Parse the entire request
     JsonValue json(request_payload);
@@ -127,6 +138,7 @@ Creation CreationHandler::parse_request(const Aws::String& request_payload)
 
     // Extract the body
     JsonView view = json.View();
+
     Aws::String body;
     if (view.KeyExists("body"))
     {
@@ -137,7 +149,7 @@ Creation CreationHandler::parse_request(const Aws::String& request_payload)
         throw std::runtime_error("Missing 'body' in request");
     }
 
-    AWS_LOGSTREAM_INFO("CreateCreation", "Extracted body: " << body);
+    AWS_LOGSTREAM_INFO("CreateCreation", "Extracted body size: " << body.size() << " bytes");
 
     // Parse the body
     JsonValue body_json(body);
@@ -148,28 +160,7 @@ Creation CreationHandler::parse_request(const Aws::String& request_payload)
 
     JsonView json_data = body_json.View();
 
-    if (!json_data.KeyExists("element_name") ||
-        !json_data.KeyExists("title") ||
-        !json_data.KeyExists("image_data") ||
-        !json_data.KeyExists("user_id"))
-    {
-        throw std::runtime_error("Missing required fields");
-    }
-
-    creation.element_name = json_data.GetString("element_name");
-    creation.title = json_data.GetString("title");
-    creation.description = json_data.GetString("description");
-    creation.image_data = json_data.GetString("image_data");
-    creation.user_id = json_data.GetString("user_id"); // From authentication context
-
-    if (json_data.KeyExists("tags"))
-    {
-        auto tags_array = json_data.GetArray("tags");
-        for (size_t i = 0; i < tags_array.GetLength(); ++i)
-        {
-            creation.tags.push_back(tags_array[i].AsString());
-        }
-    }
+    creation_schema::from_json(json_data, creation_schema::REQUEST, creation);
 
     return creation;
 }
@@ -193,23 +184,9 @@ Aws::Utils::Json::JsonValue CreationHandler::create_response(const Creation &cre
                                std::string(region.c_str()) + ".amazonaws.com/";
 
         Aws::Utils::Json::JsonValue response;
-        response.WithString("creation_id", creation.creation_id)
-            .WithString("element_name", creation.element_name)
-            .WithString("title", creation.title)
-            .WithString("image_url", base_url + creation.image_key)
-            .WithString("thumbnail_url", base_url + creation.thumbnail_key)
-            .WithString("creation_date", creation.creation_date);
-
-        // Add tags if present
-        if (!creation.tags.empty())
-        {
-            Aws::Utils::Array<Aws::Utils::Json::JsonValue> tagsArray(creation.tags.size());
-            for (size_t i = 0; i < creation.tags.size(); ++i)
-            {
-                tagsArray[i].AsString(creation.tags[i]);
-            }
-            response.WithArray("tags", tagsArray);
-        }
+        creation_schema::to_json(creation, creation_schema::RESPONSE, response);
+        response.WithString("image_url", base_url + creation.image_key)
+            .WithString("thumbnail_url", base_url + creation.thumbnail_key);
 
         AWS_LOGSTREAM_INFO("CreateCreation",
                            "Response created successfully for creation_id: "
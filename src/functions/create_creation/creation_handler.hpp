@@ -4,6 +4,7 @@
 #include "../../common/services/dynamodb_service.hpp"
 #include "../../common/services/s3_service.hpp"
 #include "../../common/models/creation.hpp"
+#include "../../common/models/request_limits.hpp"
 
 class CreationHandler
 {
@@ -11,7 +12,8 @@ public:
     CreationHandler(
         const DynamoDBService &dynamo_service,
         const S3Service &s3_service,
-        const std::string &bucket_name);
+        const std::string &bucket_name,
+        const RequestLimits &limits);
 
     aws::lambda_runtime::invocation_response handle_request(
         Creation &creation);
@@ -25,6 +27,7 @@ private:
     const S3Service& s3_service_;
 
     std::string bucket_name_;
+    RequestLimits limits_;
 
     static const char* TAG;
 };
\ No newline at end of file
@@ -13,6 +13,7 @@
 #include <aws/core/utils/memory/stl/SimpleStringStream.h>
 #include "../../common/services/dynamodb_service.hpp"
 #include "../../common/services/s3_service.hpp"
+#include "../../common/models/request_limits.hpp"
 #include "creation_handler.hpp"
 
 namespace
@@ -73,11 +74,12 @@ invocation_response my_handler(invocation_request const &request)
         // Create services and handler
         static S3Service s3_service(s3_client, bucket_name);
         static DynamoDBService dynamo_service(dynamo_client, table_name);
-        static CreationHandler handler(dynamo_service, s3_service, bucket_name);
+        static const RequestLimits limits = RequestLimits::from_environment();
+        static CreationHandler handler(dynamo_service, s3_service, bucket_name, limits);
         AWS_LOGSTREAM_INFO(TAG, "Initialized AWS Services");
 
         AWS_LOGSTREAM_INFO(TAG, "Handling request: " << request.request_id);
-        AWS_LOGSTREAM_DEBUG(TAG, "Request payload: " << request.payload);
+        AWS_LOGSTREAM_DEBUG(TAG, "Request payload size: " << request.payload.size() << " bytes");
 
         // Parse the request
         Creation creation = handler.parse_request(request.payload);
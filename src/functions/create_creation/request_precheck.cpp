@@ -0,0 +1,231 @@
+#include "request_precheck.hpp"
+#include "../../common/models/creation_schema.hpp"
+#include "../../utils/json_scanner.hpp"
+#include <aws/core/utils/logging/LogMacros.h>
+#include <cctype>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    // Enough for a data URI prefix followed by everything sniff_base64_image() reads
+    constexpr std::size_t IMAGE_PREFIX_CHARS = image_processor::BASE64_SCAN_LIMIT + 64;
+
+    bool equals_ignore_case(std::string_view a, std::string_view b)
+    {
+        if (a.size() != b.size())
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < a.size(); ++i)
+        {
+            if (std::tolower(static_cast<unsigned char>(a[i])) !=
+                std::tolower(static_cast<unsigned char>(b[i])))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void check_headers(json_scanner::Scanner &event, std::size_t payload_limit)
+    {
+        event.begin_object();
+        std::string_view name;
+        while (event.next_member(name))
+        {
+            if (!equals_ignore_case(name, "content-length") || event.peek() != '"')
+            {
+                event.skip_value();
+                continue;
+            }
+
+            char digits[24];
+            json_scanner::StringInfo info;
+            event.read_string(info, digits, sizeof(digits) - 1);
+            digits[info.captured] = '\0';
+            if (info.bytes >= sizeof(digits) ||
+                std::strtoull(digits, nullptr, 10) > payload_limit)
+            {
+                throw std::invalid_argument("Payload too large");
+            }
+        }
+    }
+
+    void check_string(json_scanner::Scanner &body, const char *name, std::size_t max_length)
+    {
+        json_scanner::StringInfo info;
+        if (body.peek() != '"' || !body.read_string(info))
+        {
+            throw std::invalid_argument(std::string("Invalid ") + name);
+        }
+        if (max_length != 0 && info.bytes > max_length)
+        {
+            throw std::invalid_argument(std::string("Field too long: ") + name);
+        }
+    }
+
+    void check_list(json_scanner::Scanner &body, const char *name, std::size_t max_length,
+                    std::size_t max_count)
+    {
+        if (body.peek() != '[' || !body.begin_array())
+        {
+            throw std::invalid_argument(std::string("Invalid ") + name);
+        }
+
+        std::size_t count = 0;
+        while (body.next_element())
+        {
+            if (++count > max_count)
+            {
+                throw std::invalid_argument("Too many " + std::string(name));
+            }
+            check_string(body, name, max_length);
+        }
+    }
+
+    image_processor::ImageHeader check_image(json_scanner::Scanner &body, const RequestLimits &limits)
+    {
+        // Copy only the prefix the header reader needs; the rest is counted in place
+        std::vector<char> prefix(IMAGE_PREFIX_CHARS);
+        json_scanner::StringInfo info;
+        if (body.peek() != '"' || !body.read_string(info, prefix.data(), prefix.size()))
+        {
+            throw std::invalid_argument("Invalid image_data");
+        }
+
+        const std::string_view captured(prefix.data(), info.captured);
+        const std::string_view base64 = image_processor::strip_data_uri(captured);
+        const std::size_t padding = info.tail[1] != '=' ? 0 : info.tail[0] != '=' ? 1 : 2;
+        const std::size_t decoded = image_processor::decoded_size(
+            info.bytes - (captured.size() - base64.size()), padding);
+        if (decoded > limits.max_image_bytes)
+        {
+            AWS_LOGSTREAM_WARN("CreateCreation", "Rejected image: " << decoded << " bytes");
+            throw std::invalid_argument("Image too large");
+        }
+
+        // Uploads are stored as .jpg and thumbnailed with the JPEG codec, so
+        // PNG and WebP are refused until the upload path carries the format
+        const auto header = image_processor::sniff_base64_image(base64);
+        if (!header || header->format != image_processor::ImageFormat::Jpeg)
+        {
+            AWS_LOGSTREAM_WARN("CreateCreation", "Rejected image: not a JPEG");
+            throw std::invalid_argument("Unsupported image format");
+        }
+
+        // Guard against decompression bombs: small files with huge pixel counts
+        if (header->width > limits.max_image_dimension ||
+            header->height > limits.max_image_dimension ||
+            static_cast<std::uint64_t>(header->width) * header->height > limits.max_image_pixels)
+        {
+            AWS_LOGSTREAM_WARN("CreateCreation",
+                               "Rejected image: " << header->width << "x" << header->height
+                                                  << " exceeds dimension limits");
+            throw std::invalid_argument("Invalid image data");
+        }
+
+        return *header;
+    }
+
+    std::optional<image_processor::ImageHeader> check_body(json_scanner::Scanner &body,
+                                                           const RequestLimits &limits)
+    {
+        std::optional<image_processor::ImageHeader> image;
+        if (!body.begin_object())
+        {
+            throw std::runtime_error("Failed to parse body JSON");
+        }
+
+        std::string_view key;
+        while (body.next_member(key))
+        {
+            bool known = false;
+            creation_schema::for_each_field([&](const auto &field, auto)
+            {
+                using Value = std::decay_t<decltype(std::declval<Creation>().*field.member)>;
+                if (known || !(field.usage & creation_schema::REQUEST) || key != field.name)
+                {
+                    return;
+                }
+                known = true;
+
+                if constexpr (std::is_same_v<Value, std::string>)
+                {
+                    if (field.member == &Creation::image_data)
+                    {
+                        image = check_image(body, limits);
+                    }
+                    else
+                    {
+                        check_string(body, field.name, field.max_length);
+                    }
+                }
+                else if constexpr (std::is_same_v<Value, std::vector<std::string>>)
+                {
+                    check_list(body, field.name, field.max_length, limits.max_tags);
+                }
+                else
+                {
+                    body.skip_value();
+                }
+            });
+
+            if (!known)
+            {
+                body.skip_value();
+            }
+        }
+
+        if (body.failed())
+        {
+            throw std::runtime_error("Failed to parse body JSON");
+        }
+        return image;
+    }
+}
+
+std::optional<image_processor::ImageHeader> precheck_create_request(
+    std::string_view payload,
+    const RequestLimits &limits)
+{
+    const std::size_t payload_limit = limits.payload_limit();
+    if (payload.size() > payload_limit)
+    {
+        throw std::invalid_argument("Payload too large");
+    }
+
+    json_scanner::Scanner event(payload);
+    if (!event.begin_object())
+    {
+        throw std::runtime_error("Failed to parse input JSON");
+    }
+
+    std::optional<image_processor::ImageHeader> image;
+    std::string_view key;
+    while (event.next_member(key))
+    {
+        if (key == "headers" && event.peek() == '{')
+        {
+            check_headers(event, payload_limit);
+        }
+        else if (key == "body" && event.peek() == '"')
+        {
+            json_scanner::Scanner body = event.embedded_document();
+            image = check_body(body, limits);
+        }
+        else
+        {
+            event.skip_value();
+        }
+    }
+
+    if (event.failed())
+    {
+        throw std::runtime_error("Failed to parse input JSON");
+    }
+    return image;
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include "../../common/models/request_limits.hpp"
+#include "../../utils/image_processor.hpp"
+#include <string_view>
+
+/**
+ * @brief Check a create request against its limits from the raw event
+ *
+ * Walks the event and its embedded body in place, so an oversized payload,
+ * declared Content-Length, field, tag list or image is rejected before the
+ * event is parsed or the body and image are copied. Only a bounded prefix of
+ * image_data is decoded to read the image header.
+ *
+ * @throws std::invalid_argument if the request exceeds a limit or the image is rejected
+ * @throws std::runtime_error if the event or body is not valid JSON
+ * @return Header of the image if the body carries image_data
+ */
+std::optional<image_processor::ImageHeader> precheck_create_request(
+    std::string_view payload,
+    const RequestLimits &limits);
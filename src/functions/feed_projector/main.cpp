@@ -0,0 +1,93 @@
+#include <aws/core/Aws.h>
+#include <aws/lambda-runtime/runtime.h>
+#include <aws/core/utils/logging/LogLevel.h>
+#include <aws/core/utils/logging/ConsoleLogSystem.h>
+#include <aws/core/platform/Environment.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/dynamodb/DynamoDBClient.h>
+#include "../../common/services/feed_service.hpp"
+#include "projector_handler.hpp"
+
+namespace
+{
+    constexpr char TAG[] = "NPUFeedProjector";
+    constexpr char ENV_FEED_TABLE_NAME[] = "FEED_TABLE_NAME";
+    constexpr char ENV_TABLE_NAME[] = "TABLE_NAME";
+    constexpr char ENV_LEADERBOARD_SIZE[] = "LEADERBOARD_SIZE";
+    constexpr char ENV_AWS_REGION[] = "AWS_REGION";
+    constexpr std::size_t DEFAULT_LEADERBOARD_SIZE = 100;
+
+    std::function<std::shared_ptr<Aws::Utils::Logging::LogSystemInterface>()>
+    GetConsoleLoggerFactory(Aws::Utils::Logging::LogLevel level)
+    {
+        return [level]
+        {
+            return Aws::MakeShared<Aws::Utils::Logging::ConsoleLogSystem>(
+                "console_logger", level);
+        };
+    }
+
+    Aws::Client::ClientConfiguration CreateClientConfig()
+    {
+        Aws::Client::ClientConfiguration config;
+        config.region = Aws::Environment::GetEnv(ENV_AWS_REGION);
+        config.caFile = "/etc/pki/tls/certs/ca-bundle.crt";
+        config.disableExpectHeader = true;
+        config.connectTimeoutMs = 5000;  // 5 second connection timeout
+        config.requestTimeoutMs = 10000; // 10 second request timeout
+        return config;
+    }
+
+    std::size_t GetLeaderboardSize()
+    {
+        const char *value = std::getenv(ENV_LEADERBOARD_SIZE);
+        return value ? std::stoul(value) : DEFAULT_LEADERBOARD_SIZE;
+    }
+}
+
+using namespace aws::lambda_runtime;
+
+invocation_response my_handler(invocation_request const &request)
+{
+    try
+    {
+        const char *table_name = std::getenv(ENV_FEED_TABLE_NAME);
+        const char *source_table_name = std::getenv(ENV_TABLE_NAME);
+        if (!table_name || !source_table_name)
+        {
+            throw std::runtime_error("Required environment variables not set");
+        }
+
+        // Clients and services live for the whole container so warm
+        // invocations reuse connections.
+        static auto config = CreateClientConfig();
+        static Aws::DynamoDB::DynamoDBClient dynamo_client(config);
+        static FeedService feed_service(dynamo_client, table_name, GetLeaderboardSize(), source_table_name);
+        static ProjectorHandler handler(feed_service);
+
+        AWS_LOGSTREAM_INFO(TAG, "Handling request: " << request.request_id);
+        return handler.handle_request(request.payload);
+    }
+    catch (const std::exception &e)
+    {
+        AWS_LOGSTREAM_ERROR(TAG, "Fatal error: " << e.what());
+        return invocation_response::failure(e.what(), "Exception");
+    }
+}
+
+int main()
+{
+    // Initialize AWS SDK
+    Aws::SDKOptions options;
+    options.loggingOptions.logLevel = Aws::Utils::Logging::LogLevel::Info;
+    options.loggingOptions.logger_create_fn = GetConsoleLoggerFactory(Aws::Utils::Logging::LogLevel::Info);
+    Aws::InitAPI(options);
+    AWS_LOGSTREAM_INFO(TAG, "AWS SDK initialized");
+
+    // Run the handler
+    run_handler(my_handler);
+
+    // Shutdown AWS SDK
+    Aws::ShutdownAPI(options);
+    return 0;
+}
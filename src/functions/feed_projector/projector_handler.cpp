@@ -0,0 +1,38 @@
+#include "projector_handler.hpp"
+#include <aws/core/utils/logging/LogMacros.h>
+
+ProjectorHandler::ProjectorHandler(const FeedService &feed_service)
+    : feed_service_(feed_service)
+{
+}
+
+aws::lambda_runtime::invocation_response
+ProjectorHandler::handle_request(const Aws::String &request_payload)
+{
+    try
+    {
+        const auto batch = parse_stream_event(request_payload);
+        for (const auto &error : batch.errors)
+        {
+            AWS_LOGSTREAM_ERROR("FeedProjector", "Skipping undecodable stream record: " << error);
+        }
+        AWS_LOGSTREAM_INFO("FeedProjector",
+                           "Applying " << batch.records.size() << " stream records");
+
+        if (!feed_service_.apply(batch.records))
+        {
+            return aws::lambda_runtime::invocation_response::failure(
+                "Failed to update feed views", "ProjectionError");
+        }
+
+        return aws::lambda_runtime::invocation_response::success(
+            "{}", "application/json");
+    }
+    catch (const std::exception &e)
+    {
+        AWS_LOGSTREAM_ERROR("FeedProjector",
+                            "Failed to process stream event: " << e.what());
+        return aws::lambda_runtime::invocation_response::failure(
+            e.what(), "InvalidStreamEvent");
+    }
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include <aws/lambda-runtime/runtime.h>
+#include "../../common/services/feed_service.hpp"
+
+class ProjectorHandler
+{
+public:
+    explicit ProjectorHandler(const FeedService &feed_service);
+
+    /**
+     * @brief Apply a DynamoDB Streams event to the feed views
+     * @param request_payload Raw stream event JSON
+     *
+     * Returns a failure when any view could not be updated so that Lambda
+     * retries the whole batch; every write is idempotent.
+     */
+    aws::lambda_runtime::invocation_response handle_request(
+        const Aws::String &request_payload);
+
+private:
+    const FeedService &feed_service_;
+};
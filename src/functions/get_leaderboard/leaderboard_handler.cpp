@@ -0,0 +1,104 @@
+#include "leaderboard_handler.hpp"
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/platform/Environment.h>
+#include <cstdlib>
+
+LeaderboardHandler::LeaderboardHandler(
+    const FeedService &feed_service,
+    const std::string &bucket_name)
+    : feed_service_(feed_service), bucket_name_(bucket_name)
+{
+}
+
+aws::lambda_runtime::invocation_response
+LeaderboardHandler::handle_request(const LeaderboardRequest &request)
+{
+    AWS_LOGSTREAM_INFO("GetLeaderboard",
+                       "Reading top " << request.page_size << " of " << request.element_name);
+
+    try
+    {
+        const auto entries = feed_service_.get_top_creations(
+            request.element_name, request.page_size);
+
+        return aws::lambda_runtime::invocation_response::success(
+            create_response(request, entries).View().WriteCompact(),
+            "application/json");
+    }
+    catch (const std::exception &e)
+    {
+        AWS_LOGSTREAM_ERROR("GetLeaderboard",
+                            "Failed to read leaderboard: " << e.what());
+        return aws::lambda_runtime::invocation_response::failure(
+            e.what(), "DatabaseError");
+    }
+}
+
+LeaderboardRequest LeaderboardHandler::parse_request(const Aws::String &request_payload)
+{
+    using namespace Aws::Utils::Json;
+
+    JsonValue json(request_payload);
+    if (!json.WasParseSuccessful())
+    {
+        throw std::runtime_error("Failed to parse input JSON");
+    }
+
+    JsonView view = json.View();
+    if (!view.ValueExists("pathParameters") ||
+        !view.GetObject("pathParameters").ValueExists("element_name"))
+    {
+        throw std::runtime_error("Missing 'element_name' in request path");
+    }
+
+    LeaderboardRequest request;
+    request.element_name = view.GetObject("pathParameters").GetString("element_name");
+    request.page_size = DEFAULT_PAGE_SIZE;
+
+    if (view.ValueExists("queryStringParameters"))
+    {
+        const JsonView query = view.GetObject("queryStringParameters");
+        if (query.ValueExists("page_size"))
+        {
+            const Aws::String value = query.GetString("page_size");
+            char *end = nullptr;
+            const unsigned long page_size = std::strtoul(value.c_str(), &end, 10);
+            if (value.empty() || *end != '\0' || page_size == 0 || page_size > MAX_PAGE_SIZE)
+            {
+                throw std::invalid_argument("Invalid page_size");
+            }
+            request.page_size = page_size;
+        }
+    }
+
+    return request;
+}
+
+Aws::Utils::Json::JsonValue LeaderboardHandler::create_response(
+    const LeaderboardRequest &request,
+    const std::vector<FeedEntry> &entries) const
+{
+    using namespace Aws::Utils::Json;
+
+    Aws::String region = Aws::Environment::GetEnv("AWS_REGION");
+    if (region.empty())
+    {
+        AWS_LOGSTREAM_ERROR("GetLeaderboard", "AWS_REGION environment variable not set");
+        throw std::runtime_error("AWS_REGION not set");
+    }
+
+    // Construct S3 URLs
+    std::string base_url = "https://" + bucket_name_ + ".s3." +
+                           std::string(region.c_str()) + ".amazonaws.com/";
+
+    Aws::Utils::Array<JsonValue> items(entries.size());
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        items[i] = entries[i].to_json(base_url);
+    }
+
+    JsonValue response;
+    response.WithString("element_name", request.element_name)
+        .WithArray("items", std::move(items));
+    return response;
+}
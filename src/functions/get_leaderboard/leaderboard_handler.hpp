@@ -0,0 +1,45 @@
+#pragma once
+#include <aws/lambda-runtime/runtime.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include "../../common/services/feed_service.hpp"
+
+/**
+ * @brief Parameters of GET /api/elements/{element_name}/top
+ */
+struct LeaderboardRequest
+{
+    std::string element_name;
+    std::size_t page_size = 0;
+};
+
+class LeaderboardHandler
+{
+public:
+    LeaderboardHandler(
+        const FeedService &feed_service,
+        const std::string &bucket_name);
+
+    /**
+     * @brief Serve the top creations of an element with a single GetItem
+     */
+    aws::lambda_runtime::invocation_response handle_request(
+        const LeaderboardRequest &request);
+
+    /**
+     * @brief Extract the element and page size from an API Gateway event
+     * @throws std::runtime_error if the event is malformed
+     * @throws std::invalid_argument if page_size is not between 1 and MAX_PAGE_SIZE
+     */
+    LeaderboardRequest parse_request(const Aws::String &request_payload);
+
+    static constexpr std::size_t DEFAULT_PAGE_SIZE = 20;
+    static constexpr std::size_t MAX_PAGE_SIZE = 100;
+
+private:
+    Aws::Utils::Json::JsonValue create_response(
+        const LeaderboardRequest &request,
+        const std::vector<FeedEntry> &entries) const;
+
+    const FeedService &feed_service_;
+    std::string bucket_name_;
+};
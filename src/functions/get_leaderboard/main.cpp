@@ -0,0 +1,87 @@
+#include <aws/core/Aws.h>
+#include <aws/lambda-runtime/runtime.h>
+#include <aws/core/utils/logging/LogLevel.h>
+#include <aws/core/utils/logging/ConsoleLogSystem.h>
+#include <aws/core/platform/Environment.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/dynamodb/DynamoDBClient.h>
+#include "../../common/services/feed_service.hpp"
+#include "leaderboard_handler.hpp"
+
+namespace
+{
+    constexpr char TAG[] = "NPUGetLeaderboard";
+    constexpr char ENV_BUCKET_NAME[] = "BUCKET_NAME";
+    constexpr char ENV_FEED_TABLE_NAME[] = "FEED_TABLE_NAME";
+    constexpr char ENV_AWS_REGION[] = "AWS_REGION";
+
+    std::function<std::shared_ptr<Aws::Utils::Logging::LogSystemInterface>()>
+    GetConsoleLoggerFactory(Aws::Utils::Logging::LogLevel level)
+    {
+        return [level]
+        {
+            return Aws::MakeShared<Aws::Utils::Logging::ConsoleLogSystem>(
+                "console_logger", level);
+        };
+    }
+
+    Aws::Client::ClientConfiguration CreateClientConfig()
+    {
+        Aws::Client::ClientConfiguration config;
+        config.region = Aws::Environment::GetEnv(ENV_AWS_REGION);
+        config.caFile = "/etc/pki/tls/certs/ca-bundle.crt";
+        config.disableExpectHeader = true;
+        config.connectTimeoutMs = 5000;  // 5 second connection timeout
+        config.requestTimeoutMs = 10000; // 10 second request timeout
+        return config;
+    }
+}
+
+using namespace aws::lambda_runtime;
+
+invocation_response my_handler(invocation_request const &request)
+{
+    try
+    {
+        const char *bucket_name = std::getenv(ENV_BUCKET_NAME);
+        const char *table_name = std::getenv(ENV_FEED_TABLE_NAME);
+        if (!bucket_name || !table_name)
+        {
+            throw std::runtime_error("Required environment variables not set");
+        }
+
+        // Clients and services live for the whole container so warm
+        // invocations reuse connections.
+        static auto config = CreateClientConfig();
+        static Aws::DynamoDB::DynamoDBClient dynamo_client(config);
+        static FeedService feed_service(dynamo_client, table_name, 0);
+        static LeaderboardHandler handler(feed_service, bucket_name);
+
+        AWS_LOGSTREAM_INFO(TAG, "Handling request: " << request.request_id);
+
+        const auto leaderboard_request = handler.parse_request(request.payload);
+        return handler.handle_request(leaderboard_request);
+    }
+    catch (const std::exception &e)
+    {
+        AWS_LOGSTREAM_ERROR(TAG, "Fatal error: " << e.what());
+        return invocation_response::failure(e.what(), "Exception");
+    }
+}
+
+int main()
+{
+    // Initialize AWS SDK
+    Aws::SDKOptions options;
+    options.loggingOptions.logLevel = Aws::Utils::Logging::LogLevel::Info;
+    options.loggingOptions.logger_create_fn = GetConsoleLoggerFactory(Aws::Utils::Logging::LogLevel::Info);
+    Aws::InitAPI(options);
+    AWS_LOGSTREAM_INFO(TAG, "AWS SDK initialized");
+
+    // Run the handler
+    run_handler(my_handler);
+
+    // Shutdown AWS SDK
+    Aws::ShutdownAPI(options);
+    return 0;
+}
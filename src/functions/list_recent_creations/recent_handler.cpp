@@ -0,0 +1,156 @@
+#include "recent_handler.hpp"
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/platform/Environment.h>
+#include <chrono>
+#include <cstdlib>
+
+namespace
+{
+    // last_evaluated_key is "<bucket>" or "<bucket>|<sort key>"
+    constexpr char TOKEN_SEPARATOR = '|';
+}
+
+RecentHandler::RecentHandler(
+    const FeedService &feed_service,
+    const std::string &bucket_name,
+    std::size_t retention_hours)
+    : feed_service_(feed_service), bucket_name_(bucket_name), retention_hours_(retention_hours)
+{
+}
+
+aws::lambda_runtime::invocation_response
+RecentHandler::handle_request(const RecentRequest &request)
+{
+    AWS_LOGSTREAM_INFO("ListRecentCreations",
+                       "Reading " << request.page_size << " creations from " << request.bucket);
+
+    try
+    {
+        // Bucket names sort chronologically, so the string compare is a time compare
+        const std::string oldest = oldest_bucket();
+        if (request.bucket < oldest)
+        {
+            return aws::lambda_runtime::invocation_response::success(
+                create_response({}, std::string()).View().WriteCompact(),
+                "application/json");
+        }
+
+        // One bucket per page: the token points back into the same bucket or
+        // at the hour before it, so an empty hour costs the client one request
+        auto page = feed_service_.get_recent_creations(
+            request.bucket, request.exclusive_start, request.page_size);
+
+        std::string last_evaluated_key;
+        if (page.bucket >= oldest)
+        {
+            last_evaluated_key = page.last_sort_key.empty()
+                                     ? page.bucket
+                                     : page.bucket + TOKEN_SEPARATOR + page.last_sort_key;
+        }
+
+        return aws::lambda_runtime::invocation_response::success(
+            create_response(page.items, last_evaluated_key).View().WriteCompact(),
+            "application/json");
+    }
+    catch (const std::exception &e)
+    {
+        AWS_LOGSTREAM_ERROR("ListRecentCreations",
+                            "Failed to read recent feed: " << e.what());
+        return aws::lambda_runtime::invocation_response::failure(
+            e.what(), "DatabaseError");
+    }
+}
+
+RecentRequest RecentHandler::parse_request(const Aws::String &request_payload)
+{
+    using namespace Aws::Utils::Json;
+
+    JsonValue json(request_payload);
+    if (!json.WasParseSuccessful())
+    {
+        throw std::runtime_error("Failed to parse input JSON");
+    }
+
+    RecentRequest request;
+    request.bucket = FeedService::recent_bucket(
+        Aws::Utils::DateTime::Now().ToGmtString(Aws::Utils::DateFormat::ISO_8601));
+    request.page_size = DEFAULT_PAGE_SIZE;
+
+    JsonView view = json.View();
+    if (!view.ValueExists("queryStringParameters"))
+    {
+        return request;
+    }
+
+    const JsonView query = view.GetObject("queryStringParameters");
+    if (query.ValueExists("page_size"))
+    {
+        const Aws::String value = query.GetString("page_size");
+        char *end = nullptr;
+        const unsigned long page_size = std::strtoul(value.c_str(), &end, 10);
+        if (value.empty() || *end != '\0' || page_size == 0 || page_size > MAX_PAGE_SIZE)
+        {
+            throw std::invalid_argument("Invalid page_size");
+        }
+        request.page_size = page_size;
+    }
+
+    if (query.ValueExists("last_evaluated_key"))
+    {
+        const std::string token = query.GetString("last_evaluated_key");
+        const std::size_t separator = token.find(TOKEN_SEPARATOR);
+        request.bucket = token.substr(0, separator);
+        request.exclusive_start = separator == std::string::npos ? std::string() : token.substr(separator + 1);
+
+        // The sort key must belong to the bucket, otherwise the Query is rejected
+        if (request.bucket != FeedService::recent_bucket(request.bucket) ||
+            (!request.exclusive_start.empty() && request.exclusive_start.rfind(request.bucket, 0) != 0))
+        {
+            throw std::invalid_argument("Invalid last_evaluated_key");
+        }
+        FeedService::previous_bucket(request.bucket); // Throws std::invalid_argument if malformed
+    }
+
+    return request;
+}
+
+Aws::Utils::Json::JsonValue RecentHandler::create_response(
+    const std::vector<FeedEntry> &entries,
+    const std::string &last_evaluated_key) const
+{
+    using namespace Aws::Utils::Json;
+
+    Aws::String region = Aws::Environment::GetEnv("AWS_REGION");
+    if (region.empty())
+    {
+        AWS_LOGSTREAM_ERROR("ListRecentCreations", "AWS_REGION environment variable not set");
+        throw std::runtime_error("AWS_REGION not set");
+    }
+
+    // Construct S3 URLs
+    std::string base_url = "https://" + bucket_name_ + ".s3." +
+                           std::string(region.c_str()) + ".amazonaws.com/";
+
+    Aws::Utils::Array<JsonValue> items(entries.size());
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        items[i] = entries[i].to_json(base_url);
+    }
+
+    JsonValue response;
+    response.WithArray("items", std::move(items));
+    if (!last_evaluated_key.empty())
+    {
+        response.WithString("last_evaluated_key", last_evaluated_key);
+    }
+    return response;
+}
+
+std::string RecentHandler::oldest_bucket() const
+{
+    const auto retention = std::chrono::hours(retention_hours_);
+    const Aws::Utils::DateTime oldest(Aws::Utils::DateTime::Now().Millis() -
+                                      std::chrono::duration_cast<std::chrono::milliseconds>(retention).count());
+    return oldest.ToGmtString("%Y-%m-%dT%H");
+}
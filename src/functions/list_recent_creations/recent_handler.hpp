@@ -0,0 +1,59 @@
+#pragma once
+#include <aws/lambda-runtime/runtime.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include "../../common/services/feed_service.hpp"
+
+/**
+ * @brief Parameters of GET /api/creations
+ */
+struct RecentRequest
+{
+    std::string bucket;          // Hour bucket to start reading from
+    std::string exclusive_start; // Sort key to continue after, empty for the start of the bucket
+    std::size_t page_size = 0;
+};
+
+class RecentHandler
+{
+public:
+    /**
+     * @param retention_hours How far back pagination goes before the feed ends
+     */
+    RecentHandler(
+        const FeedService &feed_service,
+        const std::string &bucket_name,
+        std::size_t retention_hours);
+
+    /**
+     * @brief Serve a page of the recent feed, newest first
+     *
+     * A page costs one Query and never spans hour buckets, so a page may be
+     * short or empty while last_evaluated_key is still set.
+     */
+    aws::lambda_runtime::invocation_response handle_request(
+        const RecentRequest &request);
+
+    /**
+     * @brief Extract page size and pagination token from an API Gateway event
+     * @throws std::runtime_error if the event is malformed
+     * @throws std::invalid_argument if page_size or last_evaluated_key is invalid
+     */
+    RecentRequest parse_request(const Aws::String &request_payload);
+
+    static constexpr std::size_t DEFAULT_PAGE_SIZE = 20;
+    static constexpr std::size_t MAX_PAGE_SIZE = 100;
+
+private:
+    Aws::Utils::Json::JsonValue create_response(
+        const std::vector<FeedEntry> &entries,
+        const std::string &last_evaluated_key) const;
+
+    /**
+     * @brief Oldest hour bucket still served, see retention_hours
+     */
+    std::string oldest_bucket() const;
+
+    const FeedService &feed_service_;
+    std::string bucket_name_;
+    std::size_t retention_hours_;
+};
@@ -0,0 +1,188 @@
+#include <aws/core/Aws.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/utils/logging/ConsoleLogSystem.h>
+#include <aws/core/utils/logging/LogLevel.h>
+#include <aws/dynamodb/DynamoDBClient.h>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include "../../common/models/stream_record.hpp"
+#include "../../common/services/feed_service.hpp"
+
+namespace
+{
+    constexpr char USAGE[] =
+        "Usage: replay_stream_event <event.json> [options]\n"
+        "\n"
+        "Decodes a recorded DynamoDB Streams event the way feed_projector does and\n"
+        "prints every record. With --feed-table, also applies it to the feed views.\n"
+        "Exits non-zero if any record was skipped or the views were not updated.\n"
+        "\n"
+        "Options:\n"
+        "  --feed-table <name>           Feed table to apply the event to\n"
+        "  --table <name>                Source table for leaderboard rebuilds (default: NPUCreations)\n"
+        "  --leaderboard-size <n>        Served entries per leaderboard (default: 100)\n"
+        "  --region <region>             AWS region (default: $AWS_REGION)\n"
+        "  --dynamodb-endpoint <url>     DynamoDB endpoint override, e.g. DynamoDB Local\n";
+
+    std::function<std::shared_ptr<Aws::Utils::Logging::LogSystemInterface>()>
+    GetConsoleLoggerFactory(Aws::Utils::Logging::LogLevel level)
+    {
+        return [level]
+        {
+            return Aws::MakeShared<Aws::Utils::Logging::ConsoleLogSystem>(
+                "console_logger", level);
+        };
+    }
+
+    const char *EventName(CreationStreamRecord::EventType type)
+    {
+        switch (type)
+        {
+        case CreationStreamRecord::EventType::Insert:
+            return "INSERT";
+        case CreationStreamRecord::EventType::Modify:
+            return "MODIFY";
+        case CreationStreamRecord::EventType::Remove:
+            return "REMOVE";
+        }
+        return "UNKNOWN";
+    }
+
+    void PrintImage(const char *label, const FeedEntry &entry)
+    {
+        std::cout << "    " << label << ": " << entry.creation_id
+                  << " element=" << entry.element_name
+                  << " total_score=" << entry.scores.total_score
+                  << " vote_count=" << entry.scores.vote_count << "\n";
+    }
+
+    // <event.json> followed by --name value pairs; returns false on a malformed command line
+    bool ParseArguments(int argc, char **argv, std::string &event_path,
+                        std::map<std::string, std::string> &arguments)
+    {
+        if (argc < 2)
+        {
+            return false;
+        }
+        event_path = argv[1];
+        for (int i = 2; i < argc; i += 2)
+        {
+            const std::string name = argv[i];
+            if (name.rfind("--", 0) != 0 || i + 1 >= argc)
+            {
+                return false;
+            }
+            arguments[name.substr(2)] = argv[i + 1];
+        }
+        return true;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::string event_path;
+    std::map<std::string, std::string> arguments;
+    if (!ParseArguments(argc, argv, event_path, arguments))
+    {
+        std::cerr << USAGE;
+        return EXIT_FAILURE;
+    }
+
+    const auto get = [&arguments](const char *name, const std::string &fallback)
+    {
+        const auto it = arguments.find(name);
+        return it == arguments.end() ? fallback : it->second;
+    };
+
+    std::ifstream file(event_path);
+    if (!file)
+    {
+        std::cerr << "Cannot open " << event_path << "\n";
+        return EXIT_FAILURE;
+    }
+    std::stringstream payload;
+    payload << file.rdbuf();
+
+    Aws::SDKOptions sdk_options;
+    sdk_options.loggingOptions.logLevel = Aws::Utils::Logging::LogLevel::Warn;
+    sdk_options.loggingOptions.logger_create_fn = GetConsoleLoggerFactory(Aws::Utils::Logging::LogLevel::Warn);
+    Aws::InitAPI(sdk_options);
+
+    int status = EXIT_SUCCESS;
+    try
+    {
+        const auto batch = parse_stream_event(payload.str());
+
+        for (const auto &record : batch.records)
+        {
+            std::cout << EventName(record.event_type) << "\n";
+            if (record.has_old_image)
+            {
+                PrintImage("old", record.old_image);
+            }
+            if (record.has_new_image)
+            {
+                PrintImage("new", record.new_image);
+            }
+        }
+        for (const auto &error : batch.errors)
+        {
+            std::cout << "SKIPPED " << error << "\n";
+        }
+        std::cout << batch.records.size() << " decoded, " << batch.errors.size() << " skipped\n";
+
+        if (!batch.errors.empty())
+        {
+            status = EXIT_FAILURE;
+        }
+
+        if (arguments.count("feed-table"))
+        {
+            Aws::Client::ClientConfiguration config;
+            const char *env_region = std::getenv("AWS_REGION");
+            const std::string region = get("region", env_region ? env_region : "");
+            if (!region.empty())
+            {
+                config.region = region;
+            }
+            const std::string endpoint = get("dynamodb-endpoint", "");
+            if (!endpoint.empty())
+            {
+                config.endpointOverride = endpoint;
+                if (endpoint.rfind("http://", 0) == 0)
+                {
+                    config.scheme = Aws::Http::Scheme::HTTP;
+                }
+            }
+
+            Aws::DynamoDB::DynamoDBClient dynamo_client(config);
+            const FeedService feed_service(
+                dynamo_client, arguments["feed-table"],
+                std::stoul(get("leaderboard-size", "100")),
+                get("table", "NPUCreations"));
+
+            if (feed_service.apply(batch.records))
+            {
+                std::cout << "Applied to " << arguments["feed-table"] << "\n";
+            }
+            else
+            {
+                std::cerr << "Failed to apply the event, see the log above\n";
+                status = EXIT_FAILURE;
+            }
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Replay failed: " << e.what() << "\n";
+        status = EXIT_FAILURE;
+    }
+
+    Aws::ShutdownAPI(sdk_options);
+    return status;
+}
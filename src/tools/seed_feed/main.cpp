@@ -0,0 +1,136 @@
+#include <aws/core/Aws.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/logging/ConsoleLogSystem.h>
+#include <aws/core/utils/logging/LogLevel.h>
+#include <aws/dynamodb/DynamoDBClient.h>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include "../../common/services/feed_service.hpp"
+
+namespace
+{
+    constexpr char USAGE[] =
+        "Usage: seed_feed --feed-table <name> [options]\n"
+        "\n"
+        "Builds the feed views from the source table: copies the creations of the\n"
+        "last --retention-hours into the recent feed and rebuilds the leaderboard of\n"
+        "every element. Run it once after creating the feed table, see\n"
+        "docs/aws/dynamodb-setup.md. Exits non-zero if any write failed.\n"
+        "\n"
+        "Options:\n"
+        "  --feed-table <name>           Feed table to seed\n"
+        "  --table <name>                Source table (default: NPUCreations)\n"
+        "  --leaderboard-size <n>        Served entries per leaderboard (default: 100)\n"
+        "  --retention-hours <n>         Hours of recent feed to copy (default: 720)\n"
+        "  --region <region>             AWS region (default: $AWS_REGION)\n"
+        "  --dynamodb-endpoint <url>     DynamoDB endpoint override, e.g. DynamoDB Local\n";
+
+    std::function<std::shared_ptr<Aws::Utils::Logging::LogSystemInterface>()>
+    GetConsoleLoggerFactory(Aws::Utils::Logging::LogLevel level)
+    {
+        return [level]
+        {
+            return Aws::MakeShared<Aws::Utils::Logging::ConsoleLogSystem>(
+                "console_logger", level);
+        };
+    }
+
+    // --name value pairs; returns false on a malformed command line
+    bool ParseArguments(int argc, char **argv, std::map<std::string, std::string> &arguments)
+    {
+        for (int i = 1; i < argc; i += 2)
+        {
+            const std::string name = argv[i];
+            if (name.rfind("--", 0) != 0 || i + 1 >= argc)
+            {
+                return false;
+            }
+            arguments[name.substr(2)] = argv[i + 1];
+        }
+        return true;
+    }
+
+    // Same cut-off as list_recent_creations, so nothing older than it serves is copied
+    std::string OldestBucket(std::size_t retention_hours)
+    {
+        const auto retention = std::chrono::hours(retention_hours);
+        const Aws::Utils::DateTime oldest(Aws::Utils::DateTime::Now().Millis() -
+                                          std::chrono::duration_cast<std::chrono::milliseconds>(retention).count());
+        return oldest.ToGmtString("%Y-%m-%dT%H");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::map<std::string, std::string> arguments;
+    if (!ParseArguments(argc, argv, arguments) || !arguments.count("feed-table"))
+    {
+        std::cerr << USAGE;
+        return EXIT_FAILURE;
+    }
+
+    const auto get = [&arguments](const char *name, const std::string &fallback)
+    {
+        const auto it = arguments.find(name);
+        return it == arguments.end() ? fallback : it->second;
+    };
+
+    Aws::SDKOptions sdk_options;
+    sdk_options.loggingOptions.logLevel = Aws::Utils::Logging::LogLevel::Warn;
+    sdk_options.loggingOptions.logger_create_fn = GetConsoleLoggerFactory(Aws::Utils::Logging::LogLevel::Warn);
+    Aws::InitAPI(sdk_options);
+
+    int status = EXIT_SUCCESS;
+    try
+    {
+        Aws::Client::ClientConfiguration config;
+        const char *env_region = std::getenv("AWS_REGION");
+        const std::string region = get("region", env_region ? env_region : "");
+        if (!region.empty())
+        {
+            config.region = region;
+        }
+        const std::string endpoint = get("dynamodb-endpoint", "");
+        if (!endpoint.empty())
+        {
+            config.endpointOverride = endpoint;
+            if (endpoint.rfind("http://", 0) == 0)
+            {
+                config.scheme = Aws::Http::Scheme::HTTP;
+            }
+        }
+
+        Aws::DynamoDB::DynamoDBClient dynamo_client(config);
+        const FeedService feed_service(
+            dynamo_client, arguments["feed-table"],
+            std::stoul(get("leaderboard-size", "100")),
+            get("table", "NPUCreations"));
+
+        const std::string oldest = OldestBucket(std::stoul(get("retention-hours", "720")));
+        const auto report = feed_service.seed(oldest);
+
+        std::cout << "Scanned:      " << report.scanned << "\n"
+                  << "Recent items: " << report.recent << " (since " << oldest << ")\n"
+                  << "Leaderboards: " << report.leaderboards << "\n"
+                  << "Failed:       " << report.failed << "\n";
+
+        if (report.failed > 0)
+        {
+            std::cerr << "Some feed writes failed, see the log above; the seed can be rerun\n";
+            status = EXIT_FAILURE;
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << "Seed failed: " << e.what() << "\n";
+        status = EXIT_FAILURE;
+    }
+
+    Aws::ShutdownAPI(sdk_options);
+    return status;
+}
@@ -0,0 +1,423 @@
+#include "backfill_pipeline.hpp"
+#include "../../utils/image_resizer.hpp"
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/dynamodb/model/BatchExecuteStatementRequest.h>
+#include <aws/dynamodb/model/QueryRequest.h>
+#include <aws/s3/model/GetObjectRequest.h>
+#include <aws/s3/model/ListObjectsV2Request.h>
+#include <aws/s3/model/PutObjectRequest.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <thread>
+
+namespace
+{
+    constexpr char TAG[] = "ThumbnailBackfill";
+    constexpr std::size_t MAX_BATCH_STATEMENTS = 25;
+    constexpr int LIST_PAGE_SIZE = 1000;
+    constexpr int MAX_LIST_ATTEMPTS = 6;
+    constexpr int BASE_BACKOFF_MS = 100;
+
+    // Full jitter: uniform in [0, base * 2^attempt)
+    void backoff(int attempt)
+    {
+        thread_local std::mt19937 generator(std::random_device{}());
+        std::uniform_int_distribution<int> delay(0, (BASE_BACKOFF_MS << attempt) - 1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(delay(generator)));
+    }
+
+    std::size_t resolve_threads(std::size_t requested)
+    {
+        if (requested != 0)
+        {
+            return requested;
+        }
+        const unsigned int cores = std::thread::hardware_concurrency();
+        return cores == 0 ? 1 : cores;
+    }
+
+    // images/<creation_id>.jpg -> <creation_id>
+    std::string creation_id_from_key(const std::string &key, const std::string &prefix)
+    {
+        std::string id = key.substr(prefix.size());
+        const std::size_t dot = id.rfind('.');
+        if (dot != std::string::npos)
+        {
+            id.erase(dot);
+        }
+        return id;
+    }
+
+    // Everything that changes the thumbnails written, so a checkpoint is not
+    // reused after the size, quality or destination changes
+    std::string checkpoint_settings(const BackfillPipeline::Options &options)
+    {
+        return "bucket=" + options.bucket +
+               " source_prefix=" + options.source_prefix +
+               " thumbnail_prefix=" + options.thumbnail_prefix +
+               " max_dimension=" + std::to_string(options.max_dimension) +
+               " quality=" + std::to_string(options.quality);
+    }
+
+    Aws::DynamoDB::Model::AttributeValue string_value(const std::string &value)
+    {
+        Aws::DynamoDB::Model::AttributeValue attribute;
+        attribute.SetS(value);
+        return attribute;
+    }
+}
+
+BackfillPipeline::BackfillPipeline(
+    const Aws::S3::S3Client &s3_client,
+    const Aws::DynamoDB::DynamoDBClient &dynamo_client,
+    Options options)
+    : s3_client_(s3_client),
+      dynamo_client_(dynamo_client),
+      options_(std::move(options)),
+      checkpoint_(options_.checkpoint_path, checkpoint_settings(options_)),
+      keys_(options_.max_in_flight * 2),
+      uploads_(options_.max_in_flight),
+      updates_(options_.max_in_flight),
+      in_flight_(options_.max_in_flight),
+      pool_(resolve_threads(options_.worker_threads))
+{
+}
+
+BackfillPipeline::Report BackfillPipeline::run()
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> fetchers;
+    for (std::size_t i = 0; i < options_.get_concurrency; ++i)
+    {
+        fetchers.emplace_back(&BackfillPipeline::fetch_images, this);
+    }
+    std::vector<std::thread> uploaders;
+    for (std::size_t i = 0; i < options_.put_concurrency; ++i)
+    {
+        uploaders.emplace_back(&BackfillPipeline::upload_thumbnails, this);
+    }
+    std::thread updater(&BackfillPipeline::update_table, this);
+
+    // Shut the stages down front to back so each one drains before the next closes
+    list_images();
+    keys_.close();
+    for (auto &fetcher : fetchers)
+    {
+        fetcher.join();
+    }
+
+    pool_.wait_idle();
+    uploads_.close();
+    for (auto &uploader : uploaders)
+    {
+        uploader.join();
+    }
+
+    updates_.close();
+    updater.join();
+
+    Report report;
+    report.listed = listed_;
+    report.skipped = skipped_;
+    report.processed = processed_;
+    report.failed = failed_;
+    report.orphaned = orphaned_;
+    report.listing_failed = listing_failed_;
+    report.worker_threads = pool_.size();
+    report.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return report;
+}
+
+void BackfillPipeline::list_images()
+{
+    Aws::S3::Model::ListObjectsV2Request request;
+    request.SetBucket(options_.bucket);
+    request.SetPrefix(options_.source_prefix);
+    request.SetMaxKeys(LIST_PAGE_SIZE);
+
+    for (;;)
+    {
+        auto outcome = s3_client_.ListObjectsV2(request);
+        for (int attempt = 1; !outcome.IsSuccess() && attempt < MAX_LIST_ATTEMPTS; ++attempt)
+        {
+            AWS_LOGSTREAM_WARN(TAG, "Retrying ListObjectsV2: " << outcome.GetError().GetMessage());
+            backoff(attempt);
+            outcome = s3_client_.ListObjectsV2(request);
+        }
+        if (!outcome.IsSuccess())
+        {
+            // Images past this page were never seen; the run must not look complete
+            listing_failed_ = true;
+            AWS_LOGSTREAM_ERROR(TAG, "Failed to list images after " << MAX_LIST_ATTEMPTS
+                                     << " attempts: " << outcome.GetError().GetMessage());
+            return;
+        }
+
+        const auto &result = outcome.GetResult();
+        for (const auto &object : result.GetContents())
+        {
+            const std::string key = object.GetKey();
+            if (key.size() <= options_.source_prefix.size() || key.back() == '/')
+            {
+                continue; // Folder placeholder
+            }
+
+            ++listed_;
+            if (checkpoint_.contains(key))
+            {
+                ++skipped_;
+                continue;
+            }
+            keys_.push(key);
+        }
+
+        if (!result.GetIsTruncated())
+        {
+            return;
+        }
+        request.SetContinuationToken(result.GetNextContinuationToken());
+    }
+}
+
+void BackfillPipeline::fetch_images()
+{
+    while (auto key = keys_.pop())
+    {
+        const std::string creation_id = creation_id_from_key(*key, options_.source_prefix);
+
+        // The table key is (creation_id, user_id); look it up here so the
+        // Query round trips run in parallel, and before downloading an orphan
+        std::vector<std::string> user_ids;
+        try
+        {
+            user_ids = find_user_ids(creation_id);
+        }
+        catch (const std::exception &e)
+        {
+            fail(*key, e.what());
+            continue;
+        }
+        if (user_ids.empty())
+        {
+            // Not checkpointed: the item may still be written by a later upload
+            ++orphaned_;
+            AWS_LOGSTREAM_WARN(TAG, "Skipping " << *key << ": no table item for " << creation_id);
+            continue;
+        }
+
+        // Backpressure: wait until a slot frees up further down the pipeline
+        in_flight_.acquire();
+
+        Aws::S3::Model::GetObjectRequest request;
+        request.SetBucket(options_.bucket);
+        request.SetKey(*key);
+
+        auto outcome = s3_client_.GetObject(request);
+        if (!outcome.IsSuccess())
+        {
+            in_flight_.release();
+            fail(*key, "GetObject failed: " + outcome.GetError().GetMessage());
+            continue;
+        }
+
+        auto job = std::make_shared<Job>();
+        job->image_key = *key;
+        job->creation_id = creation_id;
+        job->user_ids = std::move(user_ids);
+        job->thumbnail_key = options_.thumbnail_prefix + job->creation_id + ".jpg";
+
+        auto &result = outcome.GetResult();
+        job->data.resize(static_cast<std::size_t>(std::max<long long>(result.GetContentLength(), 0)));
+        auto &body = result.GetBody();
+        body.read(reinterpret_cast<char *>(job->data.data()),
+                  static_cast<std::streamsize>(job->data.size()));
+        if (!body || static_cast<std::size_t>(body.gcount()) != job->data.size())
+        {
+            // A truncated body would reach the decoder zero-padded
+            in_flight_.release();
+            fail(*key, "Short read: got " + std::to_string(body.gcount()) + " of " +
+                           std::to_string(job->data.size()) + " bytes");
+            continue;
+        }
+
+        pool_.submit([this, job]
+                     { resize(job); });
+    }
+}
+
+void BackfillPipeline::resize(std::shared_ptr<Job> job)
+{
+    try
+    {
+        job->data = image_processor::resize_jpeg(
+            job->data.data(), job->data.size(), options_.max_dimension, options_.quality);
+    }
+    catch (const std::exception &e)
+    {
+        in_flight_.release();
+        fail(job->image_key, e.what());
+        return;
+    }
+
+    // Never blocks: the queue holds max_in_flight jobs and each job holds a slot
+    uploads_.push(std::move(job));
+}
+
+void BackfillPipeline::upload_thumbnails()
+{
+    while (auto job = uploads_.pop())
+    {
+        auto body = Aws::MakeShared<Aws::StringStream>(TAG);
+        body->write(reinterpret_cast<const char *>((*job)->data.data()),
+                    static_cast<std::streamsize>((*job)->data.size()));
+
+        Aws::S3::Model::PutObjectRequest request;
+        request.SetBucket(options_.bucket);
+        request.SetKey((*job)->thumbnail_key);
+        request.SetContentType("image/jpeg");
+        request.SetContentLength(static_cast<long>((*job)->data.size()));
+        request.SetBody(body);
+
+        const auto outcome = s3_client_.PutObject(request);
+
+        (*job)->data.clear();
+        (*job)->data.shrink_to_fit();
+        in_flight_.release();
+
+        if (!outcome.IsSuccess())
+        {
+            fail((*job)->image_key, "PutObject failed: " + outcome.GetError().GetMessage());
+            continue;
+        }
+        updates_.push(std::move(*job));
+    }
+}
+
+void BackfillPipeline::update_table()
+{
+    std::vector<std::shared_ptr<Job>> batch;
+    batch.reserve(MAX_BATCH_STATEMENTS);
+
+    while (auto job = updates_.pop())
+    {
+        batch.push_back(std::move(*job));
+        if (batch.size() == MAX_BATCH_STATEMENTS)
+        {
+            flush_updates(batch);
+        }
+    }
+    flush_updates(batch);
+}
+
+std::vector<std::string> BackfillPipeline::find_user_ids(const std::string &creation_id) const
+{
+    Aws::DynamoDB::Model::QueryRequest request;
+    request.SetTableName(options_.table_name);
+    request.SetKeyConditionExpression("creation_id = :id");
+    request.AddExpressionAttributeValues(":id", string_value(creation_id));
+    request.SetProjectionExpression("user_id");
+
+    const auto outcome = dynamo_client_.Query(request);
+    if (!outcome.IsSuccess())
+    {
+        throw std::runtime_error("Query failed: " + outcome.GetError().GetMessage());
+    }
+
+    std::vector<std::string> user_ids;
+    for (const auto &item : outcome.GetResult().GetItems())
+    {
+        const auto it = item.find("user_id");
+        if (it != item.end())
+        {
+            user_ids.emplace_back(it->second.GetS());
+        }
+    }
+    return user_ids;
+}
+
+void BackfillPipeline::flush_updates(std::vector<std::shared_ptr<Job>> &batch)
+{
+    using namespace Aws::DynamoDB::Model;
+
+    if (batch.empty())
+    {
+        return;
+    }
+
+    const std::string statement = "UPDATE \"" + options_.table_name +
+                                  "\" SET thumbnail_key = ? WHERE creation_id = ? AND user_id = ?";
+
+    // One statement per table item; remember which job each one belongs to.
+    // A job with a non-empty error is reported once at the end.
+    Aws::Vector<BatchStatementRequest> statements;
+    std::vector<std::size_t> owners;
+    std::vector<std::string> errors(batch.size());
+    for (std::size_t i = 0; i < batch.size(); ++i)
+    {
+        for (const auto &user_id : batch[i]->user_ids)
+        {
+            statements.push_back(BatchStatementRequest()
+                                     .WithStatement(statement)
+                                     .WithParameters({string_value(batch[i]->thumbnail_key),
+                                                      string_value(batch[i]->creation_id),
+                                                      string_value(user_id)}));
+            owners.push_back(i);
+        }
+    }
+
+    for (std::size_t offset = 0; offset < statements.size(); offset += MAX_BATCH_STATEMENTS)
+    {
+        const std::size_t count = std::min(MAX_BATCH_STATEMENTS, statements.size() - offset);
+
+        BatchExecuteStatementRequest request;
+        request.SetStatements(Aws::Vector<BatchStatementRequest>(
+            statements.begin() + static_cast<std::ptrdiff_t>(offset),
+            statements.begin() + static_cast<std::ptrdiff_t>(offset + count)));
+
+        const auto outcome = dynamo_client_.BatchExecuteStatement(request);
+        if (!outcome.IsSuccess())
+        {
+            for (std::size_t i = offset; i < offset + count; ++i)
+            {
+                errors[owners[i]] = "BatchExecuteStatement failed: " + outcome.GetError().GetMessage();
+            }
+            continue;
+        }
+
+        const auto &responses = outcome.GetResult().GetResponses();
+        for (std::size_t i = 0; i < responses.size() && i < count; ++i)
+        {
+            if (responses[i].ErrorHasBeenSet())
+            {
+                errors[owners[offset + i]] = "Update failed: " + responses[i].GetError().GetMessage();
+            }
+        }
+    }
+
+    std::vector<std::string> completed;
+    completed.reserve(batch.size());
+    for (std::size_t i = 0; i < batch.size(); ++i)
+    {
+        if (errors[i].empty())
+        {
+            completed.push_back(batch[i]->image_key);
+        }
+        else
+        {
+            fail(batch[i]->image_key, errors[i]);
+        }
+    }
+
+    checkpoint_.record(completed);
+    processed_ += completed.size();
+    batch.clear();
+}
+
+void BackfillPipeline::fail(const std::string &image_key, const std::string &reason)
+{
+    ++failed_;
+    AWS_LOGSTREAM_ERROR(TAG, "Skipping " << image_key << ": " << reason);
+}
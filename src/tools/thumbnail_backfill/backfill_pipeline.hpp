@@ -0,0 +1,105 @@
+#pragma once
+#include <aws/dynamodb/DynamoDBClient.h>
+#include <aws/s3/S3Client.h>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../../utils/image_resizer.hpp"
+#include "bounded_queue.hpp"
+#include "checkpoint.hpp"
+#include "work_stealing_pool.hpp"
+
+/**
+ * @brief Regenerates thumbnails for every image under a prefix
+ *
+ * Stages, connected by bounded queues:
+ *   list (paginated) -> user_id Query + GET (get_concurrency threads)
+ *     -> resize (work-stealing pool) -> PUT (put_concurrency threads)
+ *     -> DynamoDB thumbnail_key update (batched) -> checkpoint
+ *
+ * At most max_in_flight images are held in memory between GET and PUT.
+ */
+class BackfillPipeline
+{
+public:
+    struct Options
+    {
+        std::string bucket;
+        std::string table_name;
+        std::string source_prefix = "images/";
+        std::string thumbnail_prefix = "thumbnails/";
+        std::string checkpoint_path = "thumbnail_backfill.checkpoint";
+        std::uint32_t max_dimension = image_processor::THUMBNAIL_MAX_DIMENSION;
+        int quality = image_processor::THUMBNAIL_QUALITY;
+        std::size_t get_concurrency = 16;
+        std::size_t put_concurrency = 16;
+        std::size_t max_in_flight = 64;
+        std::size_t worker_threads = 0; // 0 means one per core
+    };
+
+    struct Report
+    {
+        std::size_t listed = 0;
+        std::size_t skipped = 0;
+        std::size_t processed = 0;
+        std::size_t failed = 0;
+        std::size_t orphaned = 0; // No table item; not checkpointed
+        bool listing_failed = false; // Listing stopped early; some images were never seen
+        std::size_t worker_threads = 0;
+        double seconds = 0;
+    };
+
+    /**
+     * @throws std::runtime_error if the checkpoint file cannot be opened or
+     *         belongs to a run with different thumbnail settings
+     */
+    BackfillPipeline(
+        const Aws::S3::S3Client &s3_client,
+        const Aws::DynamoDB::DynamoDBClient &dynamo_client,
+        Options options);
+
+    /**
+     * @brief Process every image not yet in the checkpoint
+     */
+    Report run();
+
+private:
+    struct Job
+    {
+        std::string image_key;
+        std::string creation_id;
+        std::string thumbnail_key;
+        std::vector<std::string> user_ids; // One table item per user_id
+        std::vector<std::uint8_t> data;
+    };
+
+    void list_images();
+    void fetch_images();
+    void upload_thumbnails();
+    void update_table();
+
+    void resize(std::shared_ptr<Job> job);
+    void flush_updates(std::vector<std::shared_ptr<Job>> &batch);
+    std::vector<std::string> find_user_ids(const std::string &creation_id) const;
+    void fail(const std::string &image_key, const std::string &reason);
+
+    const Aws::S3::S3Client &s3_client_;
+    const Aws::DynamoDB::DynamoDBClient &dynamo_client_;
+    const Options options_;
+
+    Checkpoint checkpoint_;
+    BoundedQueue<std::string> keys_;
+    BoundedQueue<std::shared_ptr<Job>> uploads_;
+    BoundedQueue<std::shared_ptr<Job>> updates_;
+    Semaphore in_flight_;
+    WorkStealingPool pool_;
+
+    std::atomic<std::size_t> listed_{0};
+    std::atomic<std::size_t> skipped_{0};
+    std::atomic<std::size_t> processed_{0};
+    std::atomic<std::size_t> failed_{0};
+    std::atomic<std::size_t> orphaned_{0};
+    std::atomic<bool> listing_failed_{false};
+};
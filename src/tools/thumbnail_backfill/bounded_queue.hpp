@@ -0,0 +1,104 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+/**
+ * @brief Blocking FIFO with a fixed capacity
+ *
+ * push() blocks while the queue is full, which is what propagates
+ * backpressure from a slow stage to the stages feeding it.
+ */
+template <typename T>
+class BoundedQueue
+{
+public:
+    explicit BoundedQueue(std::size_t capacity) : capacity_(capacity) {}
+
+    /**
+     * @brief Append an item, waiting for space
+     * @return false if the queue was closed
+     */
+    bool push(T item)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_full_.wait(lock, [this]
+                       { return closed_ || items_.size() < capacity_; });
+        if (closed_)
+        {
+            return false;
+        }
+        items_.push_back(std::move(item));
+        not_empty_.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Take the oldest item, waiting for one
+     * @return std::nullopt once the queue is closed and drained
+     */
+    std::optional<T> pop()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_empty_.wait(lock, [this]
+                        { return closed_ || !items_.empty(); });
+        if (items_.empty())
+        {
+            return std::nullopt;
+        }
+        T item = std::move(items_.front());
+        items_.pop_front();
+        not_full_.notify_one();
+        return item;
+    }
+
+    /**
+     * @brief Stop accepting items; consumers drain what is left
+     */
+    void close()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        not_full_.notify_all();
+        not_empty_.notify_all();
+    }
+
+private:
+    const std::size_t capacity_;
+    std::deque<T> items_;
+    bool closed_ = false;
+    std::mutex mutex_;
+    std::condition_variable not_full_;
+    std::condition_variable not_empty_;
+};
+
+/**
+ * @brief Counting semaphore bounding the images held in memory at once
+ */
+class Semaphore
+{
+public:
+    explicit Semaphore(std::size_t count) : count_(count) {}
+
+    void acquire()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        available_.wait(lock, [this]
+                        { return count_ > 0; });
+        --count_;
+    }
+
+    void release()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++count_;
+        available_.notify_one();
+    }
+
+private:
+    std::size_t count_;
+    std::mutex mutex_;
+    std::condition_variable available_;
+};
@@ -0,0 +1,56 @@
+#include "checkpoint.hpp"
+#include <stdexcept>
+
+namespace
+{
+    const std::string SETTINGS_PREFIX = "# settings: ";
+}
+
+Checkpoint::Checkpoint(const std::string &path, const std::string &settings)
+{
+    const std::string header = SETTINGS_PREFIX + settings;
+
+    std::ifstream existing(path);
+    std::string line;
+    const bool resumed = static_cast<bool>(std::getline(existing, line));
+    if (resumed && line != header)
+    {
+        const std::string previous = line.rfind(SETTINGS_PREFIX, 0) == 0
+                                         ? line.substr(SETTINGS_PREFIX.size())
+                                         : "unknown";
+        throw std::runtime_error("Checkpoint " + path + " was written with different settings (" +
+                                 previous + "); delete it or pass a new --checkpoint to start fresh");
+    }
+    while (std::getline(existing, line))
+    {
+        if (!line.empty())
+        {
+            completed_.insert(line);
+        }
+    }
+
+    log_.open(path, std::ios::app);
+    if (!log_)
+    {
+        throw std::runtime_error("Failed to open checkpoint file: " + path);
+    }
+    if (!resumed)
+    {
+        log_ << header << '\n';
+        log_.flush();
+    }
+}
+
+bool Checkpoint::contains(const std::string &key) const
+{
+    return completed_.count(key) != 0;
+}
+
+void Checkpoint::record(const std::vector<std::string> &keys)
+{
+    for (const auto &key : keys)
+    {
+        log_ << key << '\n';
+    }
+    log_.flush();
+}
@@ -0,0 +1,43 @@
+#pragma once
+#include <fstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @brief Append-only log of image keys whose thumbnail is fully processed
+ *
+ * A key is recorded only after its thumbnail is uploaded and its
+ * thumbnail_key is written to DynamoDB, so an interrupted run resumes by
+ * skipping exactly the finished images. The first line records the settings
+ * the thumbnails were made with; a key only counts as finished for the same
+ * settings.
+ */
+class Checkpoint
+{
+public:
+    /**
+     * @brief Open a checkpoint file, loading the keys of a previous run
+     * @param path Checkpoint file, created if missing
+     * @param settings One-line description of the output, e.g. prefixes and thumbnail size
+     * @throws std::runtime_error if the file cannot be opened for writing or
+     *         was written with different settings
+     */
+    Checkpoint(const std::string &path, const std::string &settings);
+
+    /**
+     * @brief Whether a key was finished by a previous run
+     */
+    bool contains(const std::string &key) const;
+
+    std::size_t size() const noexcept { return completed_.size(); }
+
+    /**
+     * @brief Append finished keys and flush them to disk
+     */
+    void record(const std::vector<std::string> &keys);
+
+private:
+    std::unordered_set<std::string> completed_;
+    std::ofstream log_;
+};
@@ -0,0 +1,190 @@
+#include <aws/core/Aws.h>
+#include <aws/core/auth/AWSAuthSigner.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/utils/logging/ConsoleLogSystem.h>
+#include <aws/core/utils/logging/LogLevel.h>
+#include <aws/dynamodb/DynamoDBClient.h>
+#include <aws/s3/S3Client.h>
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include "backfill_pipeline.hpp"
+
+namespace
+{
+    constexpr char USAGE[] =
+        "Usage: thumbnail_backfill --bucket <name> --table <name> [options]\n"
+        "\n"
+        "Regenerates the thumbnail of every image under the source prefix and\n"
+        "points thumbnail_key in DynamoDB at it. Safe to interrupt and rerun.\n"
+        "\n"
+        "Options:\n"
+        "  --region <region>             AWS region (default: $AWS_REGION)\n"
+        "  --source-prefix <prefix>      Images to process (default: images/)\n"
+        "  --thumbnail-prefix <prefix>   Where thumbnails are written (default: thumbnails/)\n"
+        "  --max-dimension <px>          Longest thumbnail side (default: 320)\n"
+        "  --quality <1-100>             JPEG quality (default: 85)\n"
+        "  --checkpoint <path>           Progress file (default: thumbnail_backfill.checkpoint)\n"
+        "  --threads <n>                 Resize workers (default: one per core)\n"
+        "  --get-concurrency <n>         Concurrent GetObject calls (default: 16)\n"
+        "  --put-concurrency <n>         Concurrent PutObject calls (default: 16)\n"
+        "  --max-in-flight <n>           Images held in memory at once (default: 64)\n"
+        "  --s3-endpoint <url>           S3 endpoint override, e.g. MinIO (uses path-style addressing)\n"
+        "  --dynamodb-endpoint <url>     DynamoDB endpoint override, e.g. DynamoDB Local\n";
+
+    std::function<std::shared_ptr<Aws::Utils::Logging::LogSystemInterface>()>
+    GetConsoleLoggerFactory(Aws::Utils::Logging::LogLevel level)
+    {
+        return [level]
+        {
+            return Aws::MakeShared<Aws::Utils::Logging::ConsoleLogSystem>(
+                "console_logger", level);
+        };
+    }
+
+    Aws::Client::ClientConfiguration CreateClientConfig(
+        const std::string &region,
+        const std::string &endpoint,
+        std::size_t max_connections)
+    {
+        Aws::Client::ClientConfiguration config;
+        if (!region.empty())
+        {
+            config.region = region;
+        }
+        if (!endpoint.empty())
+        {
+            config.endpointOverride = endpoint;
+            if (endpoint.rfind("http://", 0) == 0)
+            {
+                config.scheme = Aws::Http::Scheme::HTTP;
+            }
+        }
+        config.maxConnections = static_cast<unsigned>(max_connections);
+        config.connectTimeoutMs = 5000;
+        config.requestTimeoutMs = 30000;
+        return config;
+    }
+
+    // --name value pairs; returns false on a malformed command line
+    bool ParseArguments(int argc, char **argv, std::map<std::string, std::string> &arguments)
+    {
+        for (int i = 1; i < argc; i += 2)
+        {
+            const std::string name = argv[i];
+            if (name.rfind("--", 0) != 0 || i + 1 >= argc)
+            {
+                return false;
+            }
+            arguments[name.substr(2)] = argv[i + 1];
+        }
+        return true;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::map<std::string, std::string> arguments;
+    if (!ParseArguments(argc, argv, arguments) ||
+        !arguments.count("bucket") || !arguments.count("table"))
+    {
+        std::cerr << USAGE;
+        return EXIT_FAILURE;
+    }
+
+    const auto get = [&arguments](const char *name, const std::string &fallback)
+    {
+        const auto it = arguments.find(name);
+        return it == arguments.end() ? fallback : it->second;
+    };
+    const auto get_number = [&get](const char *name, std::size_t fallback)
+    {
+        return static_cast<std::size_t>(std::stoul(get(name, std::to_string(fallback))));
+    };
+
+    BackfillPipeline::Options options;
+    options.bucket = arguments["bucket"];
+    options.table_name = arguments["table"];
+    options.source_prefix = get("source-prefix", options.source_prefix);
+    options.thumbnail_prefix = get("thumbnail-prefix", options.thumbnail_prefix);
+    options.checkpoint_path = get("checkpoint", options.checkpoint_path);
+    try
+    {
+        options.max_dimension = static_cast<std::uint32_t>(get_number("max-dimension", options.max_dimension));
+        options.quality = static_cast<int>(get_number("quality", static_cast<std::size_t>(options.quality)));
+        options.worker_threads = get_number("threads", options.worker_threads);
+        options.get_concurrency = get_number("get-concurrency", options.get_concurrency);
+        options.put_concurrency = get_number("put-concurrency", options.put_concurrency);
+        options.max_in_flight = get_number("max-in-flight", options.max_in_flight);
+    }
+    catch (const std::exception &)
+    {
+        std::cerr << USAGE;
+        return EXIT_FAILURE;
+    }
+
+    const char *env_region = std::getenv("AWS_REGION");
+    const std::string region = get("region", env_region ? env_region : "");
+    const std::string s3_endpoint = get("s3-endpoint", "");
+
+    Aws::SDKOptions sdk_options;
+    sdk_options.loggingOptions.logLevel = Aws::Utils::Logging::LogLevel::Warn;
+    sdk_options.loggingOptions.logger_create_fn = GetConsoleLoggerFactory(Aws::Utils::Logging::LogLevel::Warn);
+    Aws::InitAPI(sdk_options);
+
+    int status = EXIT_SUCCESS;
+    {
+        const auto s3_config = CreateClientConfig(
+            region, s3_endpoint, options.get_concurrency + options.put_concurrency);
+        // Every GET thread issues its own user_id Query
+        const auto dynamo_config = CreateClientConfig(
+            region, get("dynamodb-endpoint", ""), options.get_concurrency + 1);
+
+        // MinIO and other S3-compatible stores need path-style addressing
+        Aws::S3::S3Client s3_client(
+            s3_config,
+            Aws::Client::AWSAuthV4Signer::PayloadSigningPolicy::Never,
+            s3_endpoint.empty());
+        Aws::DynamoDB::DynamoDBClient dynamo_client(dynamo_config);
+
+        try
+        {
+            BackfillPipeline pipeline(s3_client, dynamo_client, options);
+            const auto report = pipeline.run();
+
+            const double per_second = report.seconds > 0 ? report.processed / report.seconds : 0;
+            const unsigned int cores = std::max(1u, std::thread::hardware_concurrency());
+            std::cout << "Listed:     " << report.listed << "\n"
+                      << "Skipped:    " << report.skipped << " (already in checkpoint)\n"
+                      << "Processed:  " << report.processed << "\n"
+                      << "Failed:     " << report.failed << "\n"
+                      << "Orphaned:   " << report.orphaned << " (no table item, not checkpointed)\n"
+                      << "Elapsed:    " << report.seconds << " s\n"
+                      << "Throughput: " << per_second << " images/s, "
+                      << per_second / cores << " images/s per core ("
+                      << cores << " cores, " << report.worker_threads << " resize workers)\n";
+
+            if (report.listing_failed)
+            {
+                std::cout << "Listing:    incomplete after retries; rerun to reach the remaining images\n";
+            }
+
+            if (report.failed > 0 || report.listing_failed)
+            {
+                status = EXIT_FAILURE;
+            }
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Backfill failed: " << e.what() << "\n";
+            status = EXIT_FAILURE;
+        }
+    }
+
+    Aws::ShutdownAPI(sdk_options);
+    return status;
+}
@@ -0,0 +1,138 @@
+#include "work_stealing_pool.hpp"
+
+namespace
+{
+    // Identifies the pool and queue of the current worker thread
+    thread_local const WorkStealingPool *current_pool = nullptr;
+    thread_local std::size_t current_index = 0;
+}
+
+WorkStealingPool::WorkStealingPool(std::size_t threads)
+{
+    if (threads == 0)
+    {
+        threads = 1;
+    }
+
+    queues_.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i)
+    {
+        queues_.push_back(std::make_unique<TaskQueue>());
+    }
+
+    workers_.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i)
+    {
+        workers_.emplace_back([this, i]
+                              { run(i); });
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(state_mutex_);
+        stopping_ = true;
+    }
+    work_available_.notify_all();
+
+    for (auto &worker : workers_)
+    {
+        worker.join();
+    }
+}
+
+void WorkStealingPool::submit(std::function<void()> task)
+{
+    std::size_t index;
+    {
+        // Count the task before it becomes visible so a worker that takes it
+        // early never sees the counters go negative.
+        std::lock_guard<std::mutex> lock(state_mutex_);
+        ++queued_;
+        ++pending_;
+        index = current_pool == this ? current_index : next_queue_++ % queues_.size();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+        queues_[index]->tasks.push_back(std::move(task));
+    }
+    work_available_.notify_one();
+}
+
+void WorkStealingPool::wait_idle()
+{
+    std::unique_lock<std::mutex> lock(state_mutex_);
+    idle_.wait(lock, [this]
+               { return pending_ == 0; });
+}
+
+bool WorkStealingPool::try_take(std::size_t index, std::function<void()> &task)
+{
+    // Own queue: newest first, its data is most likely still in cache
+    {
+        TaskQueue &own = *queues_[index];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty())
+        {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            return true;
+        }
+    }
+
+    // Steal: oldest first from the other workers
+    for (std::size_t offset = 1; offset < queues_.size(); ++offset)
+    {
+        TaskQueue &victim = *queues_[(index + offset) % queues_.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty())
+        {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingPool::run(std::size_t index)
+{
+    current_pool = this;
+    current_index = index;
+
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(state_mutex_);
+            work_available_.wait(lock, [this]
+                                 { return stopping_ || queued_ > 0; });
+            if (stopping_ && queued_ == 0)
+            {
+                return;
+            }
+        }
+
+        std::function<void()> task;
+        if (!try_take(index, task))
+        {
+            // Counted but not pushed yet, or taken by another worker
+            std::this_thread::yield();
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(state_mutex_);
+            --queued_;
+        }
+
+        task();
+
+        std::lock_guard<std::mutex> lock(state_mutex_);
+        if (--pending_ == 0)
+        {
+            idle_.notify_all();
+        }
+    }
+}
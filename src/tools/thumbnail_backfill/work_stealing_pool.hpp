@@ -0,0 +1,64 @@
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Fixed-size thread pool with per-worker queues and work stealing
+ *
+ * Tasks submitted from a worker go to that worker's own queue; external
+ * submissions are spread round-robin. An idle worker takes from the back
+ * of its own queue and steals from the front of the others, so uneven
+ * task sizes (small and huge images) do not leave cores idle.
+ */
+class WorkStealingPool
+{
+public:
+    /**
+     * @param threads Number of workers, typically the number of cores
+     */
+    explicit WorkStealingPool(std::size_t threads);
+
+    /**
+     * @brief Run the remaining tasks, then join the workers
+     */
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool &) = delete;
+    WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+    void submit(std::function<void()> task);
+
+    /**
+     * @brief Block until every submitted task has finished
+     */
+    void wait_idle();
+
+    std::size_t size() const noexcept { return workers_.size(); }
+
+private:
+    struct TaskQueue
+    {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    void run(std::size_t index);
+    bool try_take(std::size_t index, std::function<void()> &task);
+
+    std::vector<std::unique_ptr<TaskQueue>> queues_;
+    std::vector<std::thread> workers_;
+
+    std::mutex state_mutex_;
+    std::condition_variable work_available_;
+    std::condition_variable idle_;
+    std::size_t queued_ = 0;  // Submitted and not yet taken by a worker
+    std::size_t pending_ = 0; // Submitted and not yet finished
+    std::size_t next_queue_ = 0;
+    bool stopping_ = false;
+};
@@ -0,0 +1,262 @@
+#include "image_processor.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <vector>
+
+namespace image_processor
+{
+    namespace
+    {
+        constexpr std::uint8_t INVALID = 0xFF;
+        constexpr std::size_t HEADER_PREFIX = 32;
+
+        constexpr std::array<std::uint8_t, 256> make_base64_table()
+        {
+            std::array<std::uint8_t, 256> table{};
+            for (auto &value : table)
+            {
+                value = INVALID;
+            }
+            constexpr char alphabet[] =
+                "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+            for (std::uint8_t i = 0; i < 64; ++i)
+            {
+                table[static_cast<unsigned char>(alphabet[i])] = i;
+            }
+            return table;
+        }
+
+        constexpr auto BASE64_TABLE = make_base64_table();
+
+        std::uint32_t be16(const std::uint8_t *p) { return (p[0] << 8) | p[1]; }
+        std::uint32_t be32(const std::uint8_t *p)
+        {
+            return (std::uint32_t(p[0]) << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+        }
+        std::uint32_t le16(const std::uint8_t *p) { return p[0] | (p[1] << 8); }
+        std::uint32_t le24(const std::uint8_t *p) { return p[0] | (p[1] << 8) | (p[2] << 16); }
+        std::uint32_t le32(const std::uint8_t *p)
+        {
+            return p[0] | (p[1] << 8) | (p[2] << 16) | (std::uint32_t(p[3]) << 24);
+        }
+
+        std::optional<ImageHeader> make_header(ImageFormat format,
+                                               std::uint32_t width,
+                                               std::uint32_t height)
+        {
+            if (width == 0 || height == 0)
+            {
+                return std::nullopt;
+            }
+            return ImageHeader{format, width, height};
+        }
+
+        bool is_jpeg(const std::uint8_t *data, std::size_t size)
+        {
+            return size >= 3 && data[0] == 0xFF && data[1] == 0xD8 && data[2] == 0xFF;
+        }
+
+        std::optional<ImageHeader> read_png(const std::uint8_t *data, std::size_t size)
+        {
+            static constexpr std::uint8_t signature[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+            if (size < 24 ||
+                std::memcmp(data, signature, sizeof(signature)) != 0 ||
+                std::memcmp(data + 12, "IHDR", 4) != 0)
+            {
+                return std::nullopt;
+            }
+            return make_header(ImageFormat::Png, be32(data + 16), be32(data + 20));
+        }
+
+        std::optional<ImageHeader> read_webp(const std::uint8_t *data, std::size_t size)
+        {
+            if (size < 16 ||
+                std::memcmp(data, "RIFF", 4) != 0 ||
+                std::memcmp(data + 8, "WEBP", 4) != 0)
+            {
+                return std::nullopt;
+            }
+
+            const std::uint8_t *chunk = data + 12;
+            if (std::memcmp(chunk, "VP8 ", 4) == 0)
+            {
+                // Lossy: frame tag, then start code 9D 01 2A and 14-bit dimensions
+                if (size < 30 || data[23] != 0x9D || data[24] != 0x01 || data[25] != 0x2A)
+                {
+                    return std::nullopt;
+                }
+                return make_header(ImageFormat::WebP, le16(data + 26) & 0x3FFF, le16(data + 28) & 0x3FFF);
+            }
+            if (std::memcmp(chunk, "VP8L", 4) == 0)
+            {
+                // Lossless: signature byte, then (width - 1) and (height - 1) in 14 bits each
+                if (size < 25 || data[20] != 0x2F)
+                {
+                    return std::nullopt;
+                }
+                const std::uint32_t bits = le32(data + 21);
+                return make_header(ImageFormat::WebP, (bits & 0x3FFF) + 1, ((bits >> 14) & 0x3FFF) + 1);
+            }
+            if (std::memcmp(chunk, "VP8X", 4) == 0)
+            {
+                // Extended: 24-bit (canvas width - 1) and (canvas height - 1)
+                if (size < 30)
+                {
+                    return std::nullopt;
+                }
+                return make_header(ImageFormat::WebP, le24(data + 24) + 1, le24(data + 27) + 1);
+            }
+            return std::nullopt;
+        }
+
+        std::optional<ImageHeader> read_jpeg(const std::uint8_t *data, std::size_t size)
+        {
+            if (!is_jpeg(data, size))
+            {
+                return std::nullopt;
+            }
+
+            // Walk the marker segments up to the first start-of-frame
+            std::size_t pos = 2;
+            while (pos + 4 <= size)
+            {
+                if (data[pos] != 0xFF)
+                {
+                    return std::nullopt;
+                }
+
+                const std::uint8_t marker = data[pos + 1];
+                if (marker == 0xFF)
+                {
+                    ++pos; // Fill byte
+                    continue;
+                }
+                if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD8))
+                {
+                    pos += 2; // Standalone marker without a length
+                    continue;
+                }
+                if (marker == 0xD9 || marker == 0xDA)
+                {
+                    return std::nullopt; // End of image or scan data before any frame header
+                }
+
+                const std::uint32_t length = be16(data + pos + 2);
+                if (length < 2)
+                {
+                    return std::nullopt;
+                }
+
+                const bool is_frame = marker >= 0xC0 && marker <= 0xCF &&
+                                      marker != 0xC4 && marker != 0xC8 && marker != 0xCC;
+                if (is_frame)
+                {
+                    if (pos + 9 > size)
+                    {
+                        return std::nullopt;
+                    }
+                    return make_header(ImageFormat::Jpeg, be16(data + pos + 7), be16(data + pos + 5));
+                }
+
+                pos += 2 + length;
+            }
+            return std::nullopt;
+        }
+    }
+
+    std::string_view strip_data_uri(std::string_view image_data) noexcept
+    {
+        if (image_data.substr(0, 5) != "data:")
+        {
+            return image_data;
+        }
+        const std::size_t comma = image_data.find(',');
+        return comma == std::string_view::npos ? image_data : image_data.substr(comma + 1);
+    }
+
+    std::size_t decoded_size(std::string_view base64) noexcept
+    {
+        std::size_t padding = 0;
+        while (padding < 2 && padding < base64.size() && base64[base64.size() - 1 - padding] == '=')
+        {
+            ++padding;
+        }
+        return decoded_size(base64.size(), padding);
+    }
+
+    std::size_t decoded_size(std::size_t length, std::size_t padding) noexcept
+    {
+        return (length - std::min(length, padding)) * 3 / 4;
+    }
+
+    std::size_t decode_prefix(
+        std::string_view base64,
+        std::uint8_t *out,
+        std::size_t capacity) noexcept
+    {
+        std::size_t written = 0;
+        std::uint32_t buffer = 0;
+        int bits = 0;
+
+        for (const char c : base64)
+        {
+            if (written == capacity || c == '=')
+            {
+                break;
+            }
+
+            const std::uint8_t value = BASE64_TABLE[static_cast<unsigned char>(c)];
+            if (value == INVALID)
+            {
+                return 0;
+            }
+
+            buffer = (buffer << 6) | value;
+            bits += 6;
+            if (bits >= 8)
+            {
+                bits -= 8;
+                out[written++] = static_cast<std::uint8_t>(buffer >> bits);
+            }
+        }
+        return written;
+    }
+
+    std::optional<ImageHeader> read_header(
+        const std::uint8_t *data,
+        std::size_t size) noexcept
+    {
+        if (auto header = read_png(data, size))
+        {
+            return header;
+        }
+        if (auto header = read_webp(data, size))
+        {
+            return header;
+        }
+        return read_jpeg(data, size);
+    }
+
+    std::optional<ImageHeader> sniff_base64_image(std::string_view image_data)
+    {
+        const std::string_view base64 = strip_data_uri(image_data);
+
+        std::array<std::uint8_t, HEADER_PREFIX> prefix{};
+        const std::size_t prefix_size = decode_prefix(base64, prefix.data(), prefix.size());
+        if (auto header = read_header(prefix.data(), prefix_size))
+        {
+            return header;
+        }
+
+        // JPEG frame headers can sit behind EXIF/ICC segments; scan a bounded window
+        if (!is_jpeg(prefix.data(), prefix_size))
+        {
+            return std::nullopt;
+        }
+
+        std::vector<std::uint8_t> window(std::min(JPEG_SCAN_LIMIT, decoded_size(base64)));
+        const std::size_t window_size = decode_prefix(base64, window.data(), window.size());
+        return read_header(window.data(), window_size);
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+/**
+ * @brief Cheap image inspection that never decodes pixels
+ *
+ * Everything here works on a bounded prefix of the data, so the cost of
+ * rejecting a bad upload does not grow with the size of the upload.
+ */
+namespace image_processor
+{
+    enum class ImageFormat
+    {
+        Unknown,
+        Jpeg,
+        Png,
+        WebP
+    };
+
+    struct ImageHeader
+    {
+        ImageFormat format = ImageFormat::Unknown;
+        std::uint32_t width = 0;
+        std::uint32_t height = 0;
+    };
+
+    /**
+     * @brief Drop a "data:image/...;base64," prefix if present
+     */
+    std::string_view strip_data_uri(std::string_view image_data) noexcept;
+
+    /**
+     * @brief Number of bytes the base64 data decodes to, without decoding it
+     */
+    std::size_t decoded_size(std::string_view base64) noexcept;
+
+    /**
+     * @brief Number of bytes base64 data of `length` characters, `padding` of them '=', decodes to
+     */
+    std::size_t decoded_size(std::size_t length, std::size_t padding) noexcept;
+
+    /**
+     * @brief Decode at most `capacity` bytes from the start of base64 data
+     * @return Number of bytes written, 0 if the prefix is not valid base64
+     */
+    std::size_t decode_prefix(
+        std::string_view base64,
+        std::uint8_t *out,
+        std::size_t capacity) noexcept;
+
+    /**
+     * @brief Read format and dimensions from the first bytes of an image
+     * @return Header if the data starts with a complete JPEG, PNG or WebP header
+     */
+    std::optional<ImageHeader> read_header(
+        const std::uint8_t *data,
+        std::size_t size) noexcept;
+
+    /**
+     * @brief Read format and dimensions of base64 image data
+     * @param image_data Base64 encoded image, optionally with a data URI prefix
+     *
+     * Decodes only the header bytes (at most JPEG_SCAN_LIMIT for JPEGs whose
+     * size marker follows large metadata segments).
+     */
+    std::optional<ImageHeader> sniff_base64_image(std::string_view image_data);
+
+    constexpr std::size_t JPEG_SCAN_LIMIT = 128 * 1024;
+
+    // Base64 characters sniff_base64_image() reads at most, data URI excluded
+    constexpr std::size_t BASE64_SCAN_LIMIT = (JPEG_SCAN_LIMIT + 2) / 3 * 4;
+}
@@ -0,0 +1,366 @@
+#include "image_resizer.hpp"
+#include <algorithm>
+#include <csetjmp>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <jpeglib.h>
+
+namespace image_processor
+{
+    namespace
+    {
+        // Refuse to decode sources whose header declares more pixels than this
+        constexpr std::uint64_t MAX_SOURCE_PIXELS = 100'000'000;
+
+        struct Image
+        {
+            std::uint32_t width = 0;
+            std::uint32_t height = 0;
+            std::uint32_t channels = 0;
+            std::vector<std::uint8_t> pixels;
+        };
+
+        // What survives from the source besides the pixels
+        struct Metadata
+        {
+            int orientation = 1;                             // EXIF Orientation, 1-8
+            std::vector<std::vector<std::uint8_t>> icc_markers; // APP2 ICC_PROFILE segments, as stored
+        };
+
+        struct Encoded
+        {
+            unsigned char *buffer = nullptr;
+            unsigned long size = 0;
+        };
+
+        // libjpeg reports fatal errors through error_exit, which must not
+        // return. Jump back to the caller; everything the jump crosses lives
+        // outside the setjmp frame so its state stays well defined.
+        struct ErrorManager
+        {
+            jpeg_error_mgr pub;
+            std::jmp_buf jump;
+            char message[JMSG_LENGTH_MAX];
+        };
+
+        void on_error(j_common_ptr cinfo)
+        {
+            auto *error = reinterpret_cast<ErrorManager *>(cinfo->err);
+            (*cinfo->err->format_message)(cinfo, error->message);
+            std::longjmp(error->jump, 1);
+        }
+
+        void on_message(j_common_ptr) {}
+
+        constexpr unsigned int EXIF_MARKER = JPEG_APP0 + 1;
+        constexpr unsigned int ICC_MARKER = JPEG_APP0 + 2;
+        constexpr std::uint16_t ORIENTATION_TAG = 0x0112;
+
+        bool starts_with(const jpeg_saved_marker_ptr marker, const char *prefix, std::size_t length)
+        {
+            return marker->data_length >= length && std::memcmp(marker->data, prefix, length) == 0;
+        }
+
+        // Orientation from the IFD0 of an APP1 "Exif\0\0" segment; 1 if absent or malformed
+        int read_orientation(const std::uint8_t *data, std::size_t size)
+        {
+            constexpr std::size_t TIFF_START = 6;
+            if (size < TIFF_START + 8)
+            {
+                return 1;
+            }
+            const std::uint8_t *tiff = data + TIFF_START;
+            const std::size_t length = size - TIFF_START;
+            const bool little_endian = tiff[0] == 'I' && tiff[1] == 'I';
+            if (!little_endian && !(tiff[0] == 'M' && tiff[1] == 'M'))
+            {
+                return 1;
+            }
+
+            const auto read16 = [&](std::size_t at) -> std::uint32_t
+            {
+                return little_endian ? tiff[at] | tiff[at + 1] << 8 : tiff[at] << 8 | tiff[at + 1];
+            };
+            const auto read32 = [&](std::size_t at) -> std::uint32_t
+            {
+                return little_endian ? read16(at) | read16(at + 2) << 16 : read16(at) << 16 | read16(at + 2);
+            };
+
+            const std::size_t ifd = read32(4);
+            if (ifd + 2 > length)
+            {
+                return 1;
+            }
+            const std::size_t entries = read16(ifd);
+            for (std::size_t i = 0; i < entries; ++i)
+            {
+                const std::size_t entry = ifd + 2 + i * 12;
+                if (entry + 12 > length)
+                {
+                    break;
+                }
+                if (read16(entry) == ORIENTATION_TAG)
+                {
+                    const std::uint32_t value = read16(entry + 8);
+                    return value >= 1 && value <= 8 ? static_cast<int>(value) : 1;
+                }
+            }
+            return 1;
+        }
+
+        void read_metadata(const jpeg_decompress_struct &cinfo, Metadata &metadata)
+        {
+            for (jpeg_saved_marker_ptr marker = cinfo.marker_list; marker; marker = marker->next)
+            {
+                if (marker->marker == EXIF_MARKER && starts_with(marker, "Exif\0\0", 6))
+                {
+                    metadata.orientation = read_orientation(marker->data, marker->data_length);
+                }
+                else if (marker->marker == ICC_MARKER && starts_with(marker, "ICC_PROFILE\0", 12))
+                {
+                    metadata.icc_markers.emplace_back(marker->data, marker->data + marker->data_length);
+                }
+            }
+        }
+
+        bool decode_scaled(const std::uint8_t *data, std::size_t size, std::uint32_t max_dimension,
+                           Image &out, Metadata &metadata, ErrorManager &error)
+        {
+            jpeg_decompress_struct cinfo;
+            cinfo.err = jpeg_std_error(&error.pub);
+            error.pub.error_exit = on_error;
+            error.pub.output_message = on_message;
+
+            if (setjmp(error.jump))
+            {
+                jpeg_destroy_decompress(&cinfo);
+                return false;
+            }
+
+            jpeg_create_decompress(&cinfo);
+            jpeg_mem_src(&cinfo, const_cast<unsigned char *>(data), static_cast<unsigned long>(size));
+            jpeg_save_markers(&cinfo, EXIF_MARKER, 0xFFFF);
+            jpeg_save_markers(&cinfo, ICC_MARKER, 0xFFFF);
+            jpeg_read_header(&cinfo, TRUE);
+            read_metadata(cinfo, metadata);
+
+            if (static_cast<std::uint64_t>(cinfo.image_width) * cinfo.image_height > MAX_SOURCE_PIXELS)
+            {
+                std::snprintf(error.message, sizeof(error.message), "Source image too large: %ux%u",
+                              cinfo.image_width, cinfo.image_height);
+                jpeg_destroy_decompress(&cinfo);
+                return false;
+            }
+
+            // Largest 1/2^n reduction that keeps the longer side at or above the target
+            const std::uint32_t long_side = std::max(cinfo.image_width, cinfo.image_height);
+            unsigned int denom = 1;
+            while (denom < 8 && long_side / (denom * 2) >= max_dimension)
+            {
+                denom *= 2;
+            }
+            cinfo.scale_num = 1;
+            cinfo.scale_denom = denom;
+            cinfo.out_color_space = JCS_RGB;
+            cinfo.dct_method = JDCT_IFAST;
+
+            jpeg_start_decompress(&cinfo);
+
+            out.width = cinfo.output_width;
+            out.height = cinfo.output_height;
+            out.channels = static_cast<std::uint32_t>(cinfo.output_components);
+            out.pixels.resize(static_cast<std::size_t>(out.width) * out.height * out.channels);
+
+            const std::size_t stride = static_cast<std::size_t>(out.width) * out.channels;
+            while (cinfo.output_scanline < cinfo.output_height)
+            {
+                JSAMPROW row = out.pixels.data() + cinfo.output_scanline * stride;
+                jpeg_read_scanlines(&cinfo, &row, 1);
+            }
+
+            jpeg_finish_decompress(&cinfo);
+            jpeg_destroy_decompress(&cinfo);
+            return true;
+        }
+
+        bool encode(const Image &image, const Metadata &metadata, int quality,
+                    Encoded &out, ErrorManager &error)
+        {
+            jpeg_compress_struct cinfo;
+            cinfo.err = jpeg_std_error(&error.pub);
+            error.pub.error_exit = on_error;
+            error.pub.output_message = on_message;
+
+            if (setjmp(error.jump))
+            {
+                jpeg_destroy_compress(&cinfo);
+                return false;
+            }
+
+            jpeg_create_compress(&cinfo);
+            jpeg_mem_dest(&cinfo, &out.buffer, &out.size);
+
+            cinfo.image_width = image.width;
+            cinfo.image_height = image.height;
+            cinfo.input_components = static_cast<int>(image.channels);
+            cinfo.in_color_space = JCS_RGB;
+            jpeg_set_defaults(&cinfo);
+            jpeg_set_quality(&cinfo, quality, TRUE);
+
+            jpeg_start_compress(&cinfo, TRUE);
+
+            // Orientation is applied to the pixels, so only the color profile is carried over
+            for (const auto &marker : metadata.icc_markers)
+            {
+                jpeg_write_marker(&cinfo, ICC_MARKER, marker.data(), static_cast<unsigned int>(marker.size()));
+            }
+
+            const std::size_t stride = static_cast<std::size_t>(image.width) * image.channels;
+            while (cinfo.next_scanline < cinfo.image_height)
+            {
+                JSAMPROW row = const_cast<JSAMPROW>(image.pixels.data() + cinfo.next_scanline * stride);
+                jpeg_write_scanlines(&cinfo, &row, 1);
+            }
+
+            jpeg_finish_compress(&cinfo);
+            jpeg_destroy_compress(&cinfo);
+            return true;
+        }
+
+        // Area-average downscale. DCT scaling usually leaves a ratio below 2,
+        // but scale_denom stops at 8, so sources more than 16x the target
+        // still average many source pixels per output pixel.
+        Image box_resize(const Image &source, std::uint32_t width, std::uint32_t height)
+        {
+            Image target;
+            target.width = width;
+            target.height = height;
+            target.channels = source.channels;
+            target.pixels.resize(static_cast<std::size_t>(width) * height * source.channels);
+
+            const std::size_t source_stride = static_cast<std::size_t>(source.width) * source.channels;
+            for (std::uint32_t y = 0; y < height; ++y)
+            {
+                const std::uint32_t y0 = static_cast<std::uint32_t>(std::uint64_t(y) * source.height / height);
+                const std::uint32_t y1 = std::max(y0 + 1,
+                                                  static_cast<std::uint32_t>(std::uint64_t(y + 1) * source.height / height));
+                for (std::uint32_t x = 0; x < width; ++x)
+                {
+                    const std::uint32_t x0 = static_cast<std::uint32_t>(std::uint64_t(x) * source.width / width);
+                    const std::uint32_t x1 = std::max(x0 + 1,
+                                                      static_cast<std::uint32_t>(std::uint64_t(x + 1) * source.width / width));
+                    const std::uint32_t area = (x1 - x0) * (y1 - y0);
+
+                    for (std::uint32_t c = 0; c < source.channels; ++c)
+                    {
+                        std::uint32_t sum = 0;
+                        for (std::uint32_t sy = y0; sy < y1; ++sy)
+                        {
+                            const std::uint8_t *row = source.pixels.data() + sy * source_stride;
+                            for (std::uint32_t sx = x0; sx < x1; ++sx)
+                            {
+                                sum += row[sx * source.channels + c];
+                            }
+                        }
+                        target.pixels[(static_cast<std::size_t>(y) * width + x) * source.channels + c] =
+                            static_cast<std::uint8_t>((sum + area / 2) / area);
+                    }
+                }
+            }
+            return target;
+        }
+
+        // Apply an EXIF orientation so the pixels display upright without it.
+        // Orientations 5-8 swap width and height.
+        Image orient(const Image &source, int orientation)
+        {
+            const bool transposed = orientation >= 5;
+            Image target;
+            target.width = transposed ? source.height : source.width;
+            target.height = transposed ? source.width : source.height;
+            target.channels = source.channels;
+            target.pixels.resize(source.pixels.size());
+
+            const std::uint32_t w = source.width;
+            const std::uint32_t h = source.height;
+            for (std::uint32_t y = 0; y < target.height; ++y)
+            {
+                for (std::uint32_t x = 0; x < target.width; ++x)
+                {
+                    // Source pixel shown at (x, y)
+                    std::uint32_t sx = x;
+                    std::uint32_t sy = y;
+                    switch (orientation)
+                    {
+                    case 2: sx = w - 1 - x; break;
+                    case 3: sx = w - 1 - x; sy = h - 1 - y; break;
+                    case 4: sy = h - 1 - y; break;
+                    case 5: sx = y; sy = x; break;
+                    case 6: sx = y; sy = h - 1 - x; break;
+                    case 7: sx = w - 1 - y; sy = h - 1 - x; break;
+                    case 8: sx = w - 1 - y; sy = x; break;
+                    default: break;
+                    }
+                    std::memcpy(target.pixels.data() + (static_cast<std::size_t>(y) * target.width + x) * source.channels,
+                                source.pixels.data() + (static_cast<std::size_t>(sy) * w + sx) * source.channels,
+                                source.channels);
+                }
+            }
+            return target;
+        }
+    }
+
+    std::vector<std::uint8_t> resize_jpeg(
+        const std::uint8_t *data,
+        std::size_t size,
+        std::uint32_t max_dimension,
+        int quality)
+    {
+        if (max_dimension == 0)
+        {
+            throw std::invalid_argument("Thumbnail dimension must be positive");
+        }
+
+        ErrorManager error{};
+        Image decoded;
+        Metadata metadata;
+        if (!decode_scaled(data, size, max_dimension, decoded, metadata, error))
+        {
+            throw std::runtime_error(std::string("Failed to decode JPEG: ") + error.message);
+        }
+
+        const std::uint32_t long_side = std::max(decoded.width, decoded.height);
+        if (long_side > max_dimension)
+        {
+            const std::uint32_t width = std::max<std::uint32_t>(
+                1, static_cast<std::uint32_t>(std::uint64_t(decoded.width) * max_dimension / long_side));
+            const std::uint32_t height = std::max<std::uint32_t>(
+                1, static_cast<std::uint32_t>(std::uint64_t(decoded.height) * max_dimension / long_side));
+            decoded = box_resize(decoded, width, height);
+        }
+
+        // Rotate after scaling, when the buffer is smallest
+        if (metadata.orientation != 1)
+        {
+            decoded = orient(decoded, metadata.orientation);
+        }
+
+        Encoded encoded;
+        const bool success = encode(decoded, metadata, quality, encoded, error);
+        std::vector<std::uint8_t> result;
+        if (success)
+        {
+            result.assign(encoded.buffer, encoded.buffer + encoded.size);
+        }
+        std::free(encoded.buffer);
+
+        if (!success)
+        {
+            throw std::runtime_error(std::string("Failed to encode JPEG: ") + error.message);
+        }
+        return result;
+    }
+}
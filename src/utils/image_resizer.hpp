@@ -0,0 +1,31 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace image_processor
+{
+    // Thumbnails written on upload; thumbnail_backfill defaults to the same
+    constexpr std::uint32_t THUMBNAIL_MAX_DIMENSION = 320;
+    constexpr int THUMBNAIL_QUALITY = 85;
+
+    /**
+     * @brief Downscale a JPEG so its longer side is at most `max_dimension`
+     * @param data Encoded JPEG bytes
+     * @param size Number of bytes in `data`
+     * @param max_dimension Longest side of the thumbnail in pixels
+     * @param quality JPEG quality of the thumbnail (1-100)
+     * @return Encoded JPEG thumbnail
+     * @throws std::runtime_error if the image cannot be decoded or encoded
+     *
+     * Uses libjpeg's DCT-domain scaling to decode straight to the nearest
+     * larger 1/2^n size, then box-filters to the exact target, so large
+     * sources never materialize at full resolution. The EXIF Orientation is
+     * applied to the pixels and an embedded ICC profile is copied over.
+     */
+    std::vector<std::uint8_t> resize_jpeg(
+        const std::uint8_t *data,
+        std::size_t size,
+        std::uint32_t max_dimension,
+        int quality);
+}
@@ -0,0 +1,438 @@
+#include "json_scanner.hpp"
+
+namespace json_scanner
+{
+    namespace
+    {
+        int hex_value(char c) noexcept
+        {
+            if (c >= '0' && c <= '9')
+            {
+                return c - '0';
+            }
+            if (c >= 'a' && c <= 'f')
+            {
+                return c - 'a' + 10;
+            }
+            if (c >= 'A' && c <= 'F')
+            {
+                return c - 'A' + 10;
+            }
+            return -1;
+        }
+
+        // UTF-8 length of a \u escape; a surrogate pair counts as 4 on its high half
+        std::size_t utf8_bytes(std::uint32_t code_point) noexcept
+        {
+            if (code_point < 0x80)
+            {
+                return 1;
+            }
+            if (code_point < 0x800)
+            {
+                return 2;
+            }
+            if (code_point >= 0xD800 && code_point <= 0xDBFF)
+            {
+                return 4;
+            }
+            if (code_point >= 0xDC00 && code_point <= 0xDFFF)
+            {
+                return 0;
+            }
+            return 3;
+        }
+
+        // Value of the character after a backslash, END if it is not a simple escape
+        std::int32_t simple_escape(std::int32_t c) noexcept
+        {
+            switch (c)
+            {
+            case '"':
+            case '\\':
+            case '/':
+                return c;
+            case 'b':
+                return '\b';
+            case 'f':
+                return '\f';
+            case 'n':
+                return '\n';
+            case 'r':
+                return '\r';
+            case 't':
+                return '\t';
+            default:
+                return -1;
+            }
+        }
+
+        bool is_whitespace(std::int32_t c) noexcept
+        {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+        }
+
+        // Raw bytes that end a run of plain string characters, and the subset
+        // that matters when looking for the end of an embedded document
+        enum ByteClass : unsigned char
+        {
+            ENDS_RUN = 1u << 0,
+            QUOTE_OR_BACKSLASH = 1u << 1,
+        };
+
+        constexpr std::array<unsigned char, 256> BYTE_CLASSES = []
+        {
+            std::array<unsigned char, 256> classes{};
+            for (int c = 0; c < 0x20; ++c)
+            {
+                classes[c] = ENDS_RUN;
+            }
+            classes['\\'] = ENDS_RUN | QUOTE_OR_BACKSLASH;
+            classes['"'] = ENDS_RUN | QUOTE_OR_BACKSLASH;
+            return classes;
+        }();
+
+        // First byte in [first, last) of the given class, last if none
+        const char *find_class(const char *first, const char *last, unsigned char byte_class) noexcept
+        {
+            while (first != last && !(BYTE_CLASSES[static_cast<unsigned char>(*first)] & byte_class))
+            {
+                ++first;
+            }
+            return first;
+        }
+
+        // Character recorded in StringInfo::tail for a raw byte
+        char tail_char(char c) noexcept
+        {
+            return static_cast<unsigned char>(c) > 0x7F ? '?' : c;
+        }
+    }
+
+    Scanner::Scanner(std::string_view text, bool embedded) noexcept
+        : text_(text), embedded_(embedded)
+    {
+        load();
+    }
+
+    void Scanner::load() noexcept
+    {
+        current_ = END;
+        current_length_ = 0;
+        current_bytes_ = 0;
+        if (pos_ >= text_.size())
+        {
+            return;
+        }
+
+        const auto c = static_cast<unsigned char>(text_[pos_]);
+        if (!embedded_ || c != '\\')
+        {
+            current_ = c;
+            current_length_ = 1;
+            current_bytes_ = 1; // Raw bytes are already UTF-8
+            return;
+        }
+
+        // Embedded text: undo the escaping of the enclosing string literal
+        if (pos_ + 1 >= text_.size())
+        {
+            fail();
+            return;
+        }
+        const std::int32_t escaped = simple_escape(static_cast<unsigned char>(text_[pos_ + 1]));
+        if (escaped != END)
+        {
+            current_ = escaped;
+            current_length_ = 2;
+            current_bytes_ = 1;
+            return;
+        }
+        if (text_[pos_ + 1] != 'u' || pos_ + 6 > text_.size())
+        {
+            fail();
+            return;
+        }
+
+        std::uint32_t code_point = 0;
+        for (std::size_t i = pos_ + 2; i < pos_ + 6; ++i)
+        {
+            const int digit = hex_value(text_[i]);
+            if (digit < 0)
+            {
+                fail();
+                return;
+            }
+            code_point = (code_point << 4) | static_cast<std::uint32_t>(digit);
+        }
+        current_ = static_cast<std::int32_t>(code_point);
+        current_length_ = 6;
+        current_bytes_ = utf8_bytes(code_point);
+    }
+
+    void Scanner::advance() noexcept
+    {
+        pos_ += current_length_;
+        load();
+    }
+
+    void Scanner::skip_whitespace() noexcept
+    {
+        while (is_whitespace(current_))
+        {
+            advance();
+        }
+    }
+
+    bool Scanner::expect(char c) noexcept
+    {
+        skip_whitespace();
+        if (current_ != c)
+        {
+            return fail();
+        }
+        advance();
+        return true;
+    }
+
+    bool Scanner::fail() noexcept
+    {
+        failed_ = true;
+        current_ = END;
+        current_length_ = 0;
+        pos_ = text_.size();
+        return false;
+    }
+
+    char Scanner::peek() noexcept
+    {
+        skip_whitespace();
+        return current_ == END || current_ > 0x7F ? '\0' : static_cast<char>(current_);
+    }
+
+    bool Scanner::begin_object() noexcept
+    {
+        return expect('{');
+    }
+
+    bool Scanner::begin_array() noexcept
+    {
+        return expect('[');
+    }
+
+    bool Scanner::next_member(std::string_view &key) noexcept
+    {
+        skip_whitespace();
+        if (current_ == ',')
+        {
+            advance();
+            skip_whitespace();
+        }
+        if (current_ == '}')
+        {
+            advance();
+            return false;
+        }
+
+        StringInfo info;
+        if (!read_string(info, key_.data(), key_.size()))
+        {
+            return false;
+        }
+        key = std::string_view(key_.data(), info.captured);
+        return expect(':');
+    }
+
+    bool Scanner::next_element() noexcept
+    {
+        skip_whitespace();
+        if (current_ == ',')
+        {
+            advance();
+            skip_whitespace();
+        }
+        if (current_ == ']')
+        {
+            advance();
+            return false;
+        }
+        return current_ != END || fail();
+    }
+
+    void Scanner::skip_plain_run(StringInfo &info) noexcept
+    {
+        // Raw bytes other than a quote, backslash or control character stand
+        // for themselves in both plain and embedded text; read_string()
+        // decodes or rejects whatever ends the run.
+        const char *first = text_.data() + pos_;
+        const char *last = find_class(first, text_.data() + text_.size(), ENDS_RUN);
+
+        const auto length = static_cast<std::size_t>(last - first);
+        if (length == 0)
+        {
+            return;
+        }
+        info.bytes += length;
+        info.tail = {length > 1 ? tail_char(last[-2]) : info.tail[1], tail_char(last[-1])};
+        pos_ += length;
+        load();
+    }
+
+    bool Scanner::read_string(StringInfo &info, char *capture, std::size_t capacity) noexcept
+    {
+        if (!expect('"'))
+        {
+            return false;
+        }
+
+        for (;;)
+        {
+            // Nothing left to capture: take plain runs in bulk instead of
+            // decoding them one character at a time
+            if (info.captured >= capacity)
+            {
+                skip_plain_run(info);
+            }
+
+            std::int32_t value = current_;
+            std::size_t bytes = current_bytes_;
+
+            if (value == END)
+            {
+                return fail();
+            }
+            if (value == '"')
+            {
+                advance();
+                return true;
+            }
+            if (value == '\\')
+            {
+                advance();
+                value = simple_escape(current_);
+                bytes = 1;
+                if (value == END)
+                {
+                    // \uXXXX, spelled out in (possibly escaped) characters
+                    if (current_ != 'u')
+                    {
+                        return fail();
+                    }
+                    std::uint32_t code_point = 0;
+                    for (int i = 0; i < 4; ++i)
+                    {
+                        advance();
+                        const int digit = current_ > 0x7F ? -1 : hex_value(static_cast<char>(current_));
+                        if (digit < 0)
+                        {
+                            return fail();
+                        }
+                        code_point = (code_point << 4) | static_cast<std::uint32_t>(digit);
+                    }
+                    value = static_cast<std::int32_t>(code_point);
+                    bytes = utf8_bytes(code_point);
+                }
+            }
+            else if (value < 0x20)
+            {
+                return fail(); // Unescaped control character
+            }
+            advance();
+
+            // Non-ASCII characters are captured as '?'; callers only look for ASCII
+            const char c = value > 0x7F ? '?' : static_cast<char>(value);
+            info.bytes += bytes;
+            info.tail = {info.tail[1], c};
+            if (info.captured < capacity)
+            {
+                capture[info.captured++] = c;
+            }
+        }
+    }
+
+    bool Scanner::skip_value() noexcept
+    {
+        skip_whitespace();
+
+        if (current_ == '"')
+        {
+            StringInfo info;
+            return read_string(info);
+        }
+
+        if (current_ == '{' || current_ == '[')
+        {
+            // Iterative so deeply nested input cannot exhaust the stack
+            std::size_t depth = 0;
+            do
+            {
+                if (current_ == '"')
+                {
+                    StringInfo info;
+                    if (!read_string(info))
+                    {
+                        return false;
+                    }
+                    continue;
+                }
+                if (current_ == END)
+                {
+                    return fail();
+                }
+                if (current_ == '{' || current_ == '[')
+                {
+                    ++depth;
+                }
+                else if (current_ == '}' || current_ == ']')
+                {
+                    --depth;
+                }
+                advance();
+            } while (depth > 0);
+            return true;
+        }
+
+        // Number, true, false or null
+        const std::size_t start = pos_;
+        while (current_ != END && current_ != ',' && current_ != '}' && current_ != ']' &&
+               !is_whitespace(current_))
+        {
+            advance();
+        }
+        return pos_ != start || fail();
+    }
+
+    Scanner Scanner::embedded_document() noexcept
+    {
+        skip_whitespace();
+        if (embedded_ || current_ != '"')
+        {
+            fail();
+            return Scanner(std::string_view(), false);
+        }
+
+        // Find the closing quote without decoding; the nested scanner decodes
+        const std::size_t start = pos_ + 1;
+        std::size_t end = start;
+        while (end < text_.size())
+        {
+            const char *stop = find_class(text_.data() + end, text_.data() + text_.size(),
+                                          QUOTE_OR_BACKSLASH);
+            end = static_cast<std::size_t>(stop - text_.data());
+            if (end == text_.size() || *stop == '"')
+            {
+                break;
+            }
+            end += 2;
+        }
+        if (end >= text_.size())
+        {
+            fail();
+            return Scanner(std::string_view(), false);
+        }
+
+        pos_ = end + 1;
+        load();
+        return Scanner(text_.substr(start, end - start), true);
+    }
+}
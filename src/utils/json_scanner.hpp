@@ -0,0 +1,107 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/**
+ * @brief Forward-only JSON reader that never allocates
+ *
+ * Used to inspect requests before they are parsed. It reads either plain
+ * JSON text or JSON text embedded in a JSON string literal, such as the
+ * "body" of an API Gateway event, decoding that outer layer of escapes on
+ * the fly. Structure is checked only as far as needed to walk the text; a
+ * full parse is still expected afterwards.
+ */
+namespace json_scanner
+{
+    /**
+     * @brief What read_string() learned about a string value
+     */
+    struct StringInfo
+    {
+        std::size_t bytes = 0;       // UTF-8 length of the decoded value
+        std::size_t captured = 0;    // Characters copied to the capture buffer
+        std::array<char, 2> tail{};  // Last two decoded characters, tail[1] is the last
+    };
+
+    class Scanner
+    {
+    public:
+        /**
+         * @param text JSON text; must outlive the scanner
+         * @param embedded true if `text` is the inside of a JSON string literal
+         */
+        explicit Scanner(std::string_view text, bool embedded = false) noexcept;
+
+        /**
+         * @brief Next significant character without consuming it, 0 at the end
+         */
+        char peek() noexcept;
+
+        /**
+         * @brief Consume the '{' of an object
+         */
+        bool begin_object() noexcept;
+
+        /**
+         * @brief Move to the next member of the current object
+         * @param key Set to the member name; names longer than MAX_KEY_LENGTH are truncated
+         * @return false after the closing '}' or on malformed input, see failed()
+         */
+        bool next_member(std::string_view &key) noexcept;
+
+        /**
+         * @brief Consume the '[' of an array
+         */
+        bool begin_array() noexcept;
+
+        /**
+         * @brief Move to the next element of the current array
+         * @return false after the closing ']' or on malformed input, see failed()
+         */
+        bool next_element() noexcept;
+
+        /**
+         * @brief Consume a string value, copying at most `capacity` decoded characters
+         */
+        bool read_string(StringInfo &info, char *capture = nullptr, std::size_t capacity = 0) noexcept;
+
+        /**
+         * @brief Consume a value of any type
+         */
+        bool skip_value() noexcept;
+
+        /**
+         * @brief Consume a string value and return a scanner over the JSON text it contains
+         *
+         * Only one level of embedding is supported: the scanner must not be embedded itself.
+         */
+        Scanner embedded_document() noexcept;
+
+        bool failed() const noexcept { return failed_; }
+
+        static constexpr std::size_t MAX_KEY_LENGTH = 64;
+
+    private:
+        static constexpr std::int32_t END = -1;
+
+        // Decode the unit at pos_ into current_, current_length_ and current_bytes_
+        void load() noexcept;
+        void advance() noexcept;
+        void skip_whitespace() noexcept;
+        bool expect(char c) noexcept;
+        bool fail() noexcept;
+        // Consume raw characters of a string value up to the next quote, backslash or control character
+        void skip_plain_run(StringInfo &info) noexcept;
+
+        std::string_view text_;
+        bool embedded_;
+        std::size_t pos_ = 0;
+        std::int32_t current_ = END;
+        std::size_t current_length_ = 0; // Raw characters the current unit spans
+        std::size_t current_bytes_ = 0;  // UTF-8 bytes the current unit stands for
+        bool failed_ = false;
+        std::array<char, MAX_KEY_LENGTH> key_{};
+    };
+}
@@ -0,0 +1,93 @@
+#include <catch2/catch.hpp>
+#include "tools/thumbnail_backfill/checkpoint.hpp"
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+
+namespace
+{
+    // A fresh path per test, removed on destruction
+    struct TempFile
+    {
+        std::string path;
+
+        TempFile()
+        {
+            static std::atomic<int> counter{0};
+            path = (std::filesystem::temp_directory_path() /
+                    ("npu_checkpoint_test_" + std::to_string(::getpid()) + "_" + std::to_string(counter++)))
+                       .string();
+            std::filesystem::remove(path);
+        }
+        ~TempFile() { std::filesystem::remove(path); }
+    };
+}
+
+TEST_CASE("Checkpoint round-trips finished keys", "[checkpoint]")
+{
+    TempFile file;
+    {
+        Checkpoint checkpoint(file.path, "max_dimension=320");
+        CHECK(checkpoint.size() == 0);
+        checkpoint.record({"images/a.jpg", "images/b.jpg"});
+    }
+
+    Checkpoint reopened(file.path, "max_dimension=320");
+    CHECK(reopened.size() == 2);
+    CHECK(reopened.contains("images/a.jpg"));
+    CHECK(reopened.contains("images/b.jpg"));
+    CHECK_FALSE(reopened.contains("images/c.jpg"));
+}
+
+TEST_CASE("Checkpoint resumes an interrupted run", "[checkpoint]")
+{
+    TempFile file;
+    const std::vector<std::string> listing = {"images/1.jpg", "images/2.jpg", "images/3.jpg", "images/4.jpg"};
+
+    // First run finishes half the images before it is interrupted
+    {
+        Checkpoint checkpoint(file.path, "max_dimension=320");
+        checkpoint.record({listing[0], listing[2]});
+    }
+
+    // Second run skips those and finishes the rest
+    std::vector<std::string> remaining;
+    {
+        Checkpoint checkpoint(file.path, "max_dimension=320");
+        for (const auto &key : listing)
+        {
+            if (!checkpoint.contains(key))
+            {
+                remaining.push_back(key);
+            }
+        }
+        checkpoint.record(remaining);
+    }
+    CHECK(remaining == std::vector<std::string>{listing[1], listing[3]});
+
+    // Third run has nothing left
+    Checkpoint finished(file.path, "max_dimension=320");
+    for (const auto &key : listing)
+    {
+        CHECK(finished.contains(key));
+    }
+}
+
+TEST_CASE("Checkpoint refuses a run with different settings", "[checkpoint]")
+{
+    TempFile file;
+    {
+        Checkpoint checkpoint(file.path, "max_dimension=320");
+        checkpoint.record({"images/a.jpg"});
+    }
+    CHECK_THROWS_AS(Checkpoint(file.path, "max_dimension=160"), std::runtime_error);
+
+    SECTION("a checkpoint without a settings line is refused too")
+    {
+        std::ofstream(file.path, std::ios::trunc) << "images/a.jpg\n";
+        CHECK_THROWS_AS(Checkpoint(file.path, "max_dimension=320"), std::runtime_error);
+    }
+}
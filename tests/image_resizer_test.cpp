@@ -0,0 +1,213 @@
+#include <catch2/catch.hpp>
+#include "utils/image_resizer.hpp"
+#include <jpeglib.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+    struct Decoded
+    {
+        std::uint32_t width = 0;
+        std::uint32_t height = 0;
+        std::vector<std::uint8_t> pixels; // RGB
+    };
+
+    // Left half red, right half blue, so orientation can be told apart
+    std::vector<std::uint8_t> make_jpeg(std::uint32_t width, std::uint32_t height,
+                                        const std::vector<std::pair<int, std::string>> &markers = {})
+    {
+        jpeg_compress_struct cinfo;
+        jpeg_error_mgr error;
+        cinfo.err = jpeg_std_error(&error);
+        jpeg_create_compress(&cinfo);
+
+        unsigned char *buffer = nullptr;
+        unsigned long size = 0;
+        jpeg_mem_dest(&cinfo, &buffer, &size);
+        cinfo.image_width = width;
+        cinfo.image_height = height;
+        cinfo.input_components = 3;
+        cinfo.in_color_space = JCS_RGB;
+        jpeg_set_defaults(&cinfo);
+        jpeg_set_quality(&cinfo, 95, TRUE);
+        jpeg_start_compress(&cinfo, TRUE);
+        for (const auto &[marker, data] : markers)
+        {
+            jpeg_write_marker(&cinfo, marker, reinterpret_cast<const JOCTET *>(data.data()),
+                              static_cast<unsigned int>(data.size()));
+        }
+
+        std::vector<std::uint8_t> row(width * 3);
+        for (std::uint32_t x = 0; x < width; ++x)
+        {
+            const bool left = x < width / 2;
+            row[x * 3] = left ? 255 : 0;
+            row[x * 3 + 1] = 0;
+            row[x * 3 + 2] = left ? 0 : 255;
+        }
+        while (cinfo.next_scanline < cinfo.image_height)
+        {
+            JSAMPROW pointer = row.data();
+            jpeg_write_scanlines(&cinfo, &pointer, 1);
+        }
+        jpeg_finish_compress(&cinfo);
+        jpeg_destroy_compress(&cinfo);
+
+        std::vector<std::uint8_t> result(buffer, buffer + size);
+        std::free(buffer);
+        return result;
+    }
+
+    Decoded decode(const std::vector<std::uint8_t> &jpeg)
+    {
+        jpeg_decompress_struct cinfo;
+        jpeg_error_mgr error;
+        cinfo.err = jpeg_std_error(&error);
+        jpeg_create_decompress(&cinfo);
+        jpeg_mem_src(&cinfo, jpeg.data(), static_cast<unsigned long>(jpeg.size()));
+        jpeg_read_header(&cinfo, TRUE);
+        cinfo.out_color_space = JCS_RGB;
+        jpeg_start_decompress(&cinfo);
+
+        Decoded decoded;
+        decoded.width = cinfo.output_width;
+        decoded.height = cinfo.output_height;
+        decoded.pixels.resize(decoded.width * decoded.height * 3);
+        while (cinfo.output_scanline < cinfo.output_height)
+        {
+            JSAMPROW row = decoded.pixels.data() + cinfo.output_scanline * decoded.width * 3;
+            jpeg_read_scanlines(&cinfo, &row, 1);
+        }
+        jpeg_finish_decompress(&cinfo);
+        jpeg_destroy_decompress(&cinfo);
+        return decoded;
+    }
+
+    bool is_red(const Decoded &image, std::uint32_t x, std::uint32_t y)
+    {
+        const std::uint8_t *pixel = image.pixels.data() + (y * image.width + x) * 3;
+        return pixel[0] > 200 && pixel[2] < 60;
+    }
+
+    // Little-endian TIFF with a single IFD0 entry: Orientation
+    std::string exif_orientation(std::uint16_t orientation)
+    {
+        std::string exif("Exif\0\0", 6);
+        exif += std::string("II\x2a\0\x08\0\0\0", 8); // Byte order, magic, IFD0 at 8
+        exif += std::string("\x01\0", 2);              // One entry
+        exif += std::string("\x12\x01\x03\0\x01\0\0\0", 8); // Tag 0x0112, SHORT, count 1
+        exif += static_cast<char>(orientation);
+        exif += std::string("\0\0\0", 3);
+        exif += std::string("\0\0\0\0", 4); // No next IFD
+        return exif;
+    }
+
+    bool contains(const std::vector<std::uint8_t> &data, const std::string &needle)
+    {
+        return std::search(data.begin(), data.end(), needle.begin(), needle.end()) != data.end();
+    }
+}
+
+TEST_CASE("resize_jpeg fits the longer side to max_dimension", "[image_resizer]")
+{
+    using image_processor::resize_jpeg;
+
+    SECTION("landscape, DCT scaling plus box filter")
+    {
+        const auto source = make_jpeg(1000, 500);
+        const auto thumbnail = decode(resize_jpeg(source.data(), source.size(), 320, 85));
+        CHECK(thumbnail.width == 320);
+        CHECK(thumbnail.height == 160);
+    }
+
+    SECTION("portrait")
+    {
+        const auto source = make_jpeg(300, 900);
+        const auto thumbnail = decode(resize_jpeg(source.data(), source.size(), 90, 85));
+        CHECK(thumbnail.width == 30);
+        CHECK(thumbnail.height == 90);
+    }
+
+    SECTION("more than 16x the target, past the largest DCT reduction")
+    {
+        const auto source = make_jpeg(4000, 2000);
+        const auto thumbnail = decode(resize_jpeg(source.data(), source.size(), 100, 85));
+        CHECK(thumbnail.width == 100);
+        CHECK(thumbnail.height == 50);
+        CHECK(is_red(thumbnail, 10, 25));
+        CHECK_FALSE(is_red(thumbnail, 90, 25));
+    }
+
+    SECTION("smaller than the target is not enlarged")
+    {
+        const auto source = make_jpeg(64, 48);
+        const auto thumbnail = decode(resize_jpeg(source.data(), source.size(), 320, 85));
+        CHECK(thumbnail.width == 64);
+        CHECK(thumbnail.height == 48);
+    }
+}
+
+TEST_CASE("resize_jpeg applies the EXIF orientation", "[image_resizer]")
+{
+    using image_processor::resize_jpeg;
+
+    SECTION("6: rotate clockwise, the red left half ends up on top")
+    {
+        const auto source = make_jpeg(400, 200, {{JPEG_APP0 + 1, exif_orientation(6)}});
+        const auto thumbnail = decode(resize_jpeg(source.data(), source.size(), 100, 85));
+        REQUIRE(thumbnail.width == 50);
+        REQUIRE(thumbnail.height == 100);
+        CHECK(is_red(thumbnail, 25, 10));
+        CHECK_FALSE(is_red(thumbnail, 25, 90));
+    }
+
+    SECTION("8: rotate counter-clockwise, the red left half ends up at the bottom")
+    {
+        const auto source = make_jpeg(400, 200, {{JPEG_APP0 + 1, exif_orientation(8)}});
+        const auto thumbnail = decode(resize_jpeg(source.data(), source.size(), 100, 85));
+        REQUIRE(thumbnail.width == 50);
+        REQUIRE(thumbnail.height == 100);
+        CHECK_FALSE(is_red(thumbnail, 25, 10));
+        CHECK(is_red(thumbnail, 25, 90));
+    }
+
+    SECTION("2: mirror, the red half moves right")
+    {
+        const auto source = make_jpeg(400, 200, {{JPEG_APP0 + 1, exif_orientation(2)}});
+        const auto thumbnail = decode(resize_jpeg(source.data(), source.size(), 100, 85));
+        REQUIRE(thumbnail.width == 100);
+        CHECK_FALSE(is_red(thumbnail, 10, 25));
+        CHECK(is_red(thumbnail, 90, 25));
+    }
+
+    SECTION("malformed EXIF is ignored")
+    {
+        const auto source = make_jpeg(400, 200, {{JPEG_APP0 + 1, std::string("Exif\0\0MM", 8)}});
+        const auto thumbnail = decode(resize_jpeg(source.data(), source.size(), 100, 85));
+        CHECK(thumbnail.width == 100);
+        CHECK(is_red(thumbnail, 10, 25));
+    }
+}
+
+TEST_CASE("resize_jpeg keeps the ICC profile and drops EXIF", "[image_resizer]")
+{
+    const std::string icc = std::string("ICC_PROFILE\0\x01\x01", 14) + "profile-bytes";
+    const auto source = make_jpeg(400, 200, {{JPEG_APP0 + 1, exif_orientation(6)}, {JPEG_APP0 + 2, icc}});
+    const auto thumbnail = image_processor::resize_jpeg(source.data(), source.size(), 100, 85);
+
+    CHECK(contains(thumbnail, icc));
+    CHECK_FALSE(contains(thumbnail, std::string("Exif\0\0", 6)));
+}
+
+TEST_CASE("resize_jpeg rejects bad input", "[image_resizer]")
+{
+    const auto source = make_jpeg(64, 64);
+    CHECK_THROWS_AS(image_processor::resize_jpeg(source.data(), source.size(), 0, 85), std::invalid_argument);
+
+    const std::vector<std::uint8_t> garbage(100, 0x42);
+    CHECK_THROWS_AS(image_processor::resize_jpeg(garbage.data(), garbage.size(), 100, 85), std::runtime_error);
+}
@@ -0,0 +1,214 @@
+#include <catch2/catch.hpp>
+#include "utils/json_scanner.hpp"
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct ReadResult
+    {
+        bool ok = false;
+        json_scanner::StringInfo info;
+        std::string captured;
+    };
+
+    // Read the string value that `scanner` is positioned at
+    ReadResult read(json_scanner::Scanner &scanner, std::size_t capacity = 256)
+    {
+        ReadResult result;
+        std::vector<char> buffer(capacity);
+        result.ok = scanner.read_string(result.info, buffer.data(), buffer.size());
+        result.captured.assign(buffer.data(), result.info.captured);
+        return result;
+    }
+
+    ReadResult read(std::string_view text, std::size_t capacity = 256)
+    {
+        json_scanner::Scanner scanner(text);
+        return read(scanner, capacity);
+    }
+
+    std::vector<std::string> member_names(std::string_view text)
+    {
+        json_scanner::Scanner scanner(text);
+        std::vector<std::string> names;
+        scanner.begin_object();
+        std::string_view name;
+        while (scanner.next_member(name))
+        {
+            names.emplace_back(name);
+            scanner.skip_value();
+        }
+        return names;
+    }
+}
+
+TEST_CASE("Scanner decodes simple escapes", "[json_scanner]")
+{
+    const auto result = read(R"("a\"b\\c\/d\n\t")");
+    REQUIRE(result.ok);
+    CHECK(result.captured == "a\"b\\c/d\n\t");
+    CHECK(result.info.bytes == 9);
+    CHECK(result.info.tail[0] == '\n');
+    CHECK(result.info.tail[1] == '\t');
+
+    CHECK_FALSE(read(R"("bad \x escape")").ok);
+}
+
+TEST_CASE("Scanner counts \\u escapes as UTF-8 bytes", "[json_scanner]")
+{
+    // 1 + 2 + 3 bytes, then a surrogate pair counted as 4 on its high half
+    const auto result = read(R"("\u0041\u00e9\u20AC\ud83d\ude00")");
+    REQUIRE(result.ok);
+    CHECK(result.info.bytes == 10);
+    CHECK(result.captured == "A????"); // Non-ASCII is captured as '?'
+
+    CHECK_FALSE(read(R"("\u12G4")").ok);
+    CHECK_FALSE(read(R"("\u12")").ok);
+}
+
+TEST_CASE("Scanner counts raw UTF-8 and rejects control characters", "[json_scanner]")
+{
+    const auto result = read("\"caf\xC3\xA9\"");
+    REQUIRE(result.ok);
+    CHECK(result.info.bytes == 5);
+    CHECK(result.captured == "caf??");
+
+    CHECK_FALSE(read("\"a\x01z\"").ok);
+    CHECK_FALSE(read("\"" + std::string(10000, 'a') + "\n\"", 0).ok);
+}
+
+TEST_CASE("Scanner stops capturing at capacity but keeps counting", "[json_scanner]")
+{
+    const std::string base64 = std::string(100000, 'A') + "/+Q==";
+    const std::string text = "\"" + base64 + "\"";
+
+    // Past the capture buffer the value is skipped in bulk; the counts and
+    // tail must match a full decode
+    for (std::size_t capacity : {std::size_t(0), std::size_t(16), base64.size()})
+    {
+        const auto result = read(text, capacity);
+        REQUIRE(result.ok);
+        CHECK(result.info.bytes == base64.size());
+        CHECK(result.captured == base64.substr(0, capacity));
+        CHECK(result.info.tail[0] == '=');
+        CHECK(result.info.tail[1] == '=');
+    }
+
+    // An escape after the bulk run is still decoded
+    const auto escaped = read("\"" + std::string(5000, 'x') + "\\u0041\"", 0);
+    REQUIRE(escaped.ok);
+    CHECK(escaped.info.bytes == 5001);
+    CHECK(escaped.info.tail[1] == 'A');
+}
+
+TEST_CASE("Scanner truncates long member names", "[json_scanner]")
+{
+    const std::string name(json_scanner::Scanner::MAX_KEY_LENGTH + 10, 'k');
+    const auto names = member_names("{\"" + name + "\": 1, \"next\": 2}");
+    REQUIRE(names.size() == 2);
+    CHECK(names[0] == name.substr(0, json_scanner::Scanner::MAX_KEY_LENGTH));
+    CHECK(names[1] == "next");
+}
+
+TEST_CASE("Scanner reports duplicate keys in order", "[json_scanner]")
+{
+    // Duplicates are not merged, so every occurrence gets checked
+    const auto names = member_names(R"({"title": "a", "tags": [], "title": "b"})");
+    CHECK(names == std::vector<std::string>{"title", "tags", "title"});
+}
+
+TEST_CASE("Scanner skips deeply nested values without recursion", "[json_scanner]")
+{
+    constexpr std::size_t DEPTH = 200000;
+    const std::string nested = std::string(DEPTH, '[') + "\"]\"" + std::string(DEPTH, ']');
+
+    const std::string document = "{\"a\": " + nested + ", \"b\": true}";
+    json_scanner::Scanner scanner(document);
+    REQUIRE(scanner.begin_object());
+    std::string_view name;
+    REQUIRE(scanner.next_member(name));
+    CHECK(scanner.skip_value());
+    REQUIRE(scanner.next_member(name));
+    CHECK(name == "b");
+    CHECK(scanner.skip_value());
+    CHECK_FALSE(scanner.next_member(name));
+    CHECK_FALSE(scanner.failed());
+
+    const std::string unbalanced_document = std::string(DEPTH, '[') + std::string(DEPTH - 1, ']');
+    json_scanner::Scanner unbalanced(unbalanced_document);
+    CHECK_FALSE(unbalanced.skip_value());
+    CHECK(unbalanced.failed());
+}
+
+TEST_CASE("Scanner fails on truncated input", "[json_scanner]")
+{
+    for (std::string_view text : {R"({"a": "abc)", R"({"a": "abc\)", R"({"a": )", R"({"a": [1, {"b": 2})", R"({"a")"})
+    {
+        json_scanner::Scanner scanner(text);
+        REQUIRE(scanner.begin_object());
+        std::string_view name;
+        while (scanner.next_member(name) && scanner.skip_value())
+        {
+        }
+        CHECK(scanner.failed());
+    }
+
+    CHECK_FALSE(read("\"" + std::string(10000, 'a')).ok);
+}
+
+TEST_CASE("Scanner reads a document embedded in a string", "[json_scanner]")
+{
+    // The body holds {"title":"a\"b","image":"QUFB\u0041=="} escaped once more
+    const std::string event =
+        R"({"headers": {}, "body": "{\"title\":\"a\\\"b\",\"image\":\"QUFB\\u0041==\"}", "after": 1})";
+
+    json_scanner::Scanner scanner(event);
+    REQUIRE(scanner.begin_object());
+    std::string_view name;
+    REQUIRE(scanner.next_member(name));
+    REQUIRE(scanner.skip_value());
+    REQUIRE(scanner.next_member(name));
+    REQUIRE(name == "body");
+
+    json_scanner::Scanner body = scanner.embedded_document();
+    REQUIRE(body.begin_object());
+    std::string_view key;
+    REQUIRE(body.next_member(key));
+    CHECK(key == "title");
+    const auto title = read(body);
+    REQUIRE(title.ok);
+    CHECK(title.captured == "a\"b");
+
+    REQUIRE(body.next_member(key));
+    CHECK(key == "image");
+    const auto image = read(body, 0);
+    REQUIRE(image.ok);
+    CHECK(image.info.bytes == 7);
+    CHECK(image.info.tail[0] == '=');
+    CHECK(image.info.tail[1] == '=');
+    CHECK_FALSE(body.next_member(key));
+    CHECK_FALSE(body.failed());
+
+    // The outer scanner continues after the body
+    REQUIRE(scanner.next_member(name));
+    CHECK(name == "after");
+}
+
+TEST_CASE("Scanner fails on a truncated embedded document", "[json_scanner]")
+{
+    json_scanner::Scanner scanner(R"({"body": "{\"title\":\"abc)");
+    REQUIRE(scanner.begin_object());
+    std::string_view name;
+    REQUIRE(scanner.next_member(name));
+    json_scanner::Scanner body = scanner.embedded_document();
+    CHECK(scanner.failed());
+    CHECK_FALSE(body.begin_object());
+
+    // A dangling outer escape inside the embedded text
+    json_scanner::Scanner dangling("{\\\"a\\\":\\\"b\\", true);
+    REQUIRE(dangling.begin_object());
+    REQUIRE(dangling.next_member(name));
+    CHECK_FALSE(read(dangling).ok);
+    CHECK(dangling.failed());
+}
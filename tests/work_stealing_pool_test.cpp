@@ -0,0 +1,79 @@
+#include <catch2/catch.hpp>
+#include "tools/thumbnail_backfill/work_stealing_pool.hpp"
+#include <atomic>
+#include <chrono>
+#include <set>
+
+TEST_CASE("WorkStealingPool runs every task before wait_idle returns", "[work_stealing_pool]")
+{
+    WorkStealingPool pool(4);
+    CHECK(pool.size() == 4);
+
+    std::atomic<int> done{0};
+    for (int i = 0; i < 1000; ++i)
+    {
+        pool.submit([&done]
+                    { ++done; });
+    }
+    pool.wait_idle();
+    CHECK(done == 1000);
+
+    // The pool is reusable after going idle
+    pool.submit([&done]
+                { ++done; });
+    pool.wait_idle();
+    CHECK(done == 1001);
+}
+
+TEST_CASE("WorkStealingPool runs tasks submitted from workers", "[work_stealing_pool]")
+{
+    WorkStealingPool pool(3);
+    std::atomic<int> done{0};
+    for (int i = 0; i < 10; ++i)
+    {
+        pool.submit([&pool, &done]
+                    {
+                        for (int j = 0; j < 10; ++j)
+                        {
+                            pool.submit([&done] { ++done; });
+                        } });
+    }
+    pool.wait_idle();
+    CHECK(done == 100);
+}
+
+TEST_CASE("WorkStealingPool spreads a skewed load across workers", "[work_stealing_pool]")
+{
+    WorkStealingPool pool(4);
+    std::mutex mutex;
+    std::set<std::thread::id> workers;
+
+    // One worker enqueues everything; the others only get work by stealing
+    pool.submit([&]
+                {
+                    for (int i = 0; i < 64; ++i)
+                    {
+                        pool.submit([&]
+                                    {
+                                        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                                        std::lock_guard<std::mutex> lock(mutex);
+                                        workers.insert(std::this_thread::get_id());
+                                    });
+                    } });
+    pool.wait_idle();
+    CHECK(workers.size() > 1);
+}
+
+TEST_CASE("WorkStealingPool finishes queued tasks on destruction", "[work_stealing_pool]")
+{
+    std::atomic<int> done{0};
+    {
+        WorkStealingPool pool(2);
+        for (int i = 0; i < 100; ++i)
+        {
+            pool.submit([&done]
+                        { ++done; });
+        }
+    }
+    CHECK(done == 100);
+}